@@ -1,14 +1,80 @@
 #include "src/Game.hpp"
+#include "src/engine/Profiler.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
 #include <ctime>
 #include <SDL2/SDL.h>
 
+// Headless, uncapped playback of a recorded session. Returns nonzero on desync. With a metrics path,
+// every tick is streamed as one frame, so a session can be profiled again offline.
+static int runReplay(const char* path, bool verify, const char* metricsPath) {
+    Replay::Player player;
+    if (!player.load(path)) { fprintf(stderr, "replay: cannot load %s\n", path); return 2; }
+    gameRng().reseed(player.seed);
+    Game game(true);
+    game.replaying = true;
+    if (player.flags & Replay::ENDURANCE) { game.endurance = true; game.init(); }
+    if (metricsPath && !game.metrics.open(metricsPath)) { fprintf(stderr, "metrics: cannot write %s\n", metricsPath); return 2; }
+    std::vector<double> tickUs;
+    tickUs.reserve(player.totalTicks);
+    long desyncTick = -1;
+    uint64_t expected;
+    auto st = std::chrono::steady_clock::now();
+    while (game.running && player.next(game.input, expected)) {
+        auto t0 = std::chrono::steady_clock::now();
+        game.handleInput();
+        if (verify && expected && desyncTick < 0 && game.stateHash() != expected) desyncTick = player.position() - 1;
+        game.update();
+        tickUs.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count());
+        if (metricsPath) { Profiler::get().endFrame(); game.recordMetrics(1, (float)tickUs.back()); }
+    }
+    double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - st).count();
+    std::sort(tickUs.begin(), tickUs.end());
+    auto pct = [&](double q) { return tickUs.empty() ? 0.0 : tickUs[std::min(tickUs.size() - 1, (size_t)(q * tickUs.size()))]; };
+    printf("replay: %zu ticks in %.3fs (%.0f ticks/s), tick p50 %.1fus p99 %.1fus\n",
+           tickUs.size(), secs, secs > 0 ? tickUs.size() / secs : 0.0, pct(0.5), pct(0.99));
+    if (tickUs.size() != player.totalTicks) { printf("replay: stream truncated at tick %zu of %u\n", tickUs.size(), player.totalTicks); return 1; }
+    if (desyncTick >= 0) { printf("replay: DESYNC at tick %ld\n", desyncTick); return 1; }
+    if (verify) printf("replay: state hashes match\n");
+    return 0;
+}
+
 int main(int argc, char** argv) {
-    (void)argc; (void)argv;
+    const char* recordPath = "recoil_session.replay";
+    const char* replayPath = nullptr;
+    const char* metricsPath = nullptr;
+    bool verify = false, vsync = true, endurance = false;
+    int fpsCap = -1;
+    for (int i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "--record") && i + 1 < argc) recordPath = argv[++i];
+        else if (!strcmp(argv[i], "--replay") && i + 1 < argc) replayPath = argv[++i];
+        else if (!strcmp(argv[i], "--verify")) verify = true;
+        else if (!strcmp(argv[i], "--no-vsync")) vsync = false;
+        else if (!strcmp(argv[i], "--endurance")) endurance = true;
+        else if (!strcmp(argv[i], "--fps-cap") && i + 1 < argc) fpsCap = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--metrics") && i + 1 < argc) metricsPath = argv[++i];
+    }
+    if (replayPath) {
+        SDL_Init(0);
+        int rc = runReplay(replayPath, verify, metricsPath);
+        SDL_Quit();
+        return rc;
+    }
+
     SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO);
     srand((unsigned int)time(NULL));
+    uint64_t seed = (uint64_t)time(NULL);
+    gameRng().reseed(seed);
     {
-        Game game;
+        Game game(false, vsync);
+        if (fpsCap >= 0) game.pacer.fpsCap = fpsCap;
+        if (endurance) { game.endurance = true; game.init(); }
+        if (metricsPath && !game.metrics.open(metricsPath)) fprintf(stderr, "metrics: cannot write %s\n", metricsPath);
+        game.recorder.begin(seed, endurance ? Replay::ENDURANCE : 0);
         game.loop();
+        if (!game.recorder.save(recordPath)) fprintf(stderr, "replay: cannot write %s\n", recordPath);
     }
     SDL_Quit();
     return 0;
@@ -1,14 +1,13 @@
 #include "Game.hpp"
 #include <iostream>
-#include <queue>
 #include "gameplay/Environmental.hpp"
+#include "gameplay/Serialize.hpp"
+#include "engine/Profiler.hpp"
+#include "core/FastMath.hpp"
 
 void ObjectiveSystem::update(Game& game) {
-    bool all = true;
-    for (auto c : game.cores) {
-        if (!c->sanitized) { all = false; break; }
-    }
-    if (all) {
+    if (game.endurance) { currentType = ENDURE; return; }
+    if (game.coreStats.allSanitized()) {
         currentType = REACH_EXIT;
         if (game.exit) game.exit->active = true;
     } else {
@@ -16,27 +15,42 @@ void ObjectiveSystem::update(Game& game) {
     }
 }
 
-std::string ObjectiveSystem::getDesc() const {
+const char* ObjectiveSystem::getDesc() const {
+    if (currentType == ENDURE) return "OBJECTIVE: Survive. Sanitize cores as the sector unfolds.";
     return (currentType == CLEAR_CORES) ? "OBJECTIVE: Neutralize Rogue AI Cores." : "OBJECTIVE: Proceed to extraction point.";
 }
 
-Game::Game() {
-    TTF_Init();
-    win = SDL_CreateWindow("Recoil Protocol", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, SCREEN_WIDTH, SCREEN_HEIGHT, SDL_WINDOW_SHOWN);
-    ren = SDL_CreateRenderer(win, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
-    lighting.init(ren);
+Game::Game(bool headless, bool vsync, int workers, bool start) : headless(headless), jobs(workers) {
+    if (!headless) {
+        TTF_Init();
+        win = SDL_CreateWindow("Recoil Protocol", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, SCREEN_WIDTH, SCREEN_HEIGHT, SDL_WINDOW_SHOWN);
+        ren = SDL_CreateRenderer(win, -1, SDL_RENDERER_ACCELERATED | (vsync ? SDL_RENDERER_PRESENTVSYNC : 0));
+        // Without working vsync, fall back to a software cap so we don't spin at thousands of fps
+        SDL_RendererInfo info;
+        if (vsync && (SDL_GetRendererInfo(ren, &info) != 0 || !(info.flags & SDL_RENDERER_PRESENTVSYNC))) pacer.fpsCap = TARGET_FPS;
+        lighting.init(ren);
+        audio.init();
 #ifdef __APPLE__
-    font = TTF_OpenFont("/System/Library/Fonts/Helvetica.ttc", 18); fontL = TTF_OpenFont("/System/Library/Fonts/Helvetica.ttc", 52);
+        font = TTF_OpenFont("/System/Library/Fonts/Helvetica.ttc", 18); fontL = TTF_OpenFont("/System/Library/Fonts/Helvetica.ttc", 52);
 #else
-    font = TTF_OpenFont("arial.ttf", 18); fontL = TTF_OpenFont("arial.ttf", 52);
+        font = TTF_OpenFont("arial.ttf", 18); fontL = TTF_OpenFont("arial.ttf", 52);
 #endif
-    init();
+    }
+    // Reserve the working set up front so steady-state ticks don't grow containers
+    cores.reserve(128); slugs.reserve(512); echoes.reserve(64); movers.reserve(128); pendingSpawns.reserve(32); coreProx.reserve(128);
+    chunkEvents.resize(512 / 32); // One event buffer per slug chunk in simulate()
+    vfx.particles.reserve(4096);
+    visitedChunks.reserve(4096); coreChunks.reserve(4096); dormantCores.reserve(128); dormantItems.reserve(128); dormantDecorations.reserve(128);
+    visible.cores.reserve(128); visible.slugs.reserve(512); visible.items.reserve(64); visible.echoes.reserve(64); visible.decorations.reserve(128); visHits.reserve(512);
+    if (start) init();
 }
 
 Game::~Game() {
     cleanup();
     if(font) TTF_CloseFont(font);
     if(fontL) TTF_CloseFont(fontL);
+    if (headless) return;
+    hud.text.clear(); // Textures must go before their renderer
     SDL_DestroyRenderer(ren);
     SDL_DestroyWindow(win);
     TTF_Quit();
@@ -44,125 +58,251 @@ Game::~Game() {
 
 void Game::init() {
     cleanup();
-    generateLevel();
-    p = new Player(findSpace(24, 24));
-    p->reserveSlugs = 60;
-    for (int i = 0; i < 5 + sector * 2; ++i) cores.push_back(new RogueCore(findSpace(28, 28)));
-    if (sector % 2 == 0) {
-        for (int i = 0; i < 2 + sector / 2; ++i) cores.push_back(new SeekerSwarm(findSpace(20, 20)));
+    SectorPlan plan;
+    plan.sector = sector;
+    if (endurance) {
+        world.reset(gameRand64());
+        worldCx = -ChunkedWorld::WINDOW_W / 2; worldCy = -ChunkedWorld::WINDOW_H / 2;
+        world.fillWindow(worldCx, worldCy, plan.map);
+        for (int wy = 0; wy < ChunkedWorld::WINDOW_H; ++wy) for (int wx = 0; wx < ChunkedWorld::WINDOW_W; ++wx) visitedChunks.push_back(ChunkedWorld::chunkKey(worldCx + wx, worldCy + wy));
+        std::sort(visitedChunks.begin(), visitedChunks.end());
+        coreChunks = visitedChunks; // The opening layout stands in for these chunks' rolls
+        plan.hasExit = false;
+        SectorGen::layout(plan, gameRng());
+    } else {
+        plan.seed = gameRand64();
+        SectorGen::build(plan);
     }
-    if (sector % 5 == 0) {
-        cores.push_back(new FinalBossCore(findSpace(80, 80)));
+    startSector(plan);
+}
+
+// Lays out the next sector on a worker while the summary screen is up. The seed is drawn here on the
+// simulation thread, so the sector is the same whether the job finishes early, late or on confirm.
+void Game::planNextSector() {
+    jobs.wait(planJob);
+    nextSectorSeed = gameRand64();
+    submitPlan();
+}
+
+void Game::submitPlan() {
+    nextPlan.sector = sector + 1; nextPlan.seed = nextSectorSeed;
+    jobs.submit({[](void* ctx, int, int) { SectorGen::build(*(SectorPlan*)ctx); }, &nextPlan, 0, 1, &planJob});
+}
+
+// Builds entities from a finished plan; the map is swapped in rather than copied.
+void Game::startSector(SectorPlan& plan) {
+    map.swap(plan.map);
+    p = arena.make<Player>(plan.player);
+    p->reserveSlugs = 60;
+    for (Vec2 at : plan.cores) cores.push_back(arena.make<RogueCore>(at));
+    for (Vec2 at : plan.swarms) cores.push_back(arena.make<SeekerSwarm>(at));
+    if (plan.hasBoss) {
+        cores.push_back(arena.make<FinalBossCore>(plan.boss));
         hud.addLog("CRITICAL: BOSS ANOMALY DETECTED!", {255, 50, 50, 255});
     }
-    for (int i = 0; i < 8; ++i) items.push_back(new Item(findSpace(20, 20), (rand() % 100 < 40) ? ItemType::BATTERY_PACK : ItemType::REPAIR_KIT));
-    for (int i = 0; i < 6 + sector; ++i) {
-        SoundType st = (rand() % 3 == 0) ? SoundType::MACHINERY : (rand() % 2 == 0 ? SoundType::STEAM : SoundType::DRIP);
+    coreStats.recount(cores);
+    for (const auto& it : plan.items) items.push_back(arena.make<Item>(it.first, it.second));
+    for (const auto& d : plan.decorations) {
+        SoundType st = d.second;
         SDL_Color c = (st == SoundType::MACHINERY) ? SDL_Color{100, 100, 255, 255} : (st == SoundType::STEAM ? SDL_Color{255, 100, 100, 255} : SDL_Color{100, 255, 255, 255});
-        decorations.push_back(new DecorativeMachine(findSpace(32, 32), st, c));
+        decorations.push_back(arena.make<DecorativeMachine>(d.first, st, c));
     }
-    exit = new Entity(findSpace(40, 40), 40, 40, EntityType::EXIT);
-    exit->active = false;
+    if (plan.hasExit) { exit = arena.make<Entity>(plan.exit, 40, 40, EntityType::EXIT); exit->active = false; }
+    plan.sector = -1; // Spent: its map now holds the previous sector's tiles
     state = GameState::PLAYING;
-    hud.addLog("SYSTEM ONLINE. SECTOR " + std::to_string(sector));
+    char msg[48]; snprintf(msg, sizeof(msg), "SYSTEM ONLINE. SECTOR %d", sector);
+    hud.addLog(msg);
     audio.play(SoundType::POWERUP, 0.4f, 200.0f);
     titleTimer = 3.0f;
 }
 
 void Game::cleanup() {
-    if(p) delete p;
-    for(auto c:cores) delete c;
-    for(auto s:slugs) delete s;
-    for(auto e:echoes) delete e;
-    for(auto i:items) delete i;
-    for(auto d:decorations) delete d;
-    if(exit) delete exit;
-    cores.clear(); slugs.clear(); echoes.clear(); items.clear(); decorations.clear(); fTexts.clear();
-}
-
-Vec2 Game::findSpace(float w, float h) {
-    for(int i = 0; i < 2000; ++i) {
-        int x = 1 + rand() % (MAP_WIDTH - 2);
-        int y = 1 + rand() % (MAP_HEIGHT - 2);
-        if (map[y][x].type == FLOOR) {
-            Rect r = {(float)x * TILE_SIZE + 2, (float)y * TILE_SIZE + 2, w, h};
-            bool safe = true;
-            for (int sy = y - 1; sy <= y + 2; sy++) {
-                for (int sx = x - 1; sx <= x + 2; sx++) {
-                    if (sx >= 0 && sx < MAP_WIDTH && sy >= 0 && sy < MAP_HEIGHT && map[sy][sx].type == WALL && r.intersects(map[sy][sx].rect)) safe = false;
-                }
-            }
-            if (safe) return {r.x, r.y};
+    jobs.wait(planJob); // A plan in flight writes into nextPlan
+    arena.reset();
+    p = nullptr; exit = nullptr;
+    aiSched.clear();
+    cores.clear(); slugs.clear(); echoes.clear(); items.clear(); decorations.clear(); fTexts.clear(); coreStats.clear();
+    dormantCores.clear(); dormantItems.clear(); dormantDecorations.clear(); visitedChunks.clear(); coreChunks.clear(); dormantTimer = 0.0f;
+    steadyTicks = 0;
+}
+
+// Nearest spot to e whose footprint is clear of walls, searched in growing rings of tiles
+bool Game::placeOnFloor(Entity* e) {
+    int tx = (int)(e->bounds.center().x / TILE_SIZE), ty = (int)(e->bounds.center().y / TILE_SIZE);
+    for (int r = 0; r < 4; ++r) for (int y = ty - r; y <= ty + r; ++y) for (int x = tx - r; x <= tx + r; ++x) {
+        if (std::max(std::abs(x - tx), std::abs(y - ty)) != r || x < 1 || y < 1 || x >= MAP_WIDTH - 1 || y >= MAP_HEIGHT - 1) continue;
+        Rect at = {x * TILE_SIZE + (TILE_SIZE - e->bounds.w) / 2, y * TILE_SIZE + (TILE_SIZE - e->bounds.h) / 2, e->bounds.w, e->bounds.h};
+        bool clear = true;
+        for (int sy = y - 2; sy <= y + 2 && clear; ++sy) for (int sx = x - 2; sx <= x + 2; ++sx) {
+            if (sx >= 0 && sy >= 0 && sx < MAP_WIDTH && sy < MAP_HEIGHT && map[sy][sx].type == WALL && at.intersects(map[sy][sx].rect)) { clear = false; break; }
         }
+        if (!clear) continue;
+        e->pos = e->prevPos = {at.x, at.y}; e->bounds.x = at.x; e->bounds.y = at.y;
+        return true;
     }
-    return {MAP_WIDTH * TILE_SIZE / 2.0f, MAP_HEIGHT * TILE_SIZE / 2.0f};
+    return false;
 }
 
-void Game::generateLevel() {
-    bool connected = false;
-    while (!connected) {
-        map.assign(MAP_HEIGHT, std::vector<Tile>(MAP_WIDTH));
-        for (int y = 0; y < MAP_HEIGHT; ++y) {
-            for (int x = 0; x < MAP_WIDTH; ++x) {
-                map[y][x].type = WALL;
-                map[y][x].rect = {(float)x * TILE_SIZE, (float)y * TILE_SIZE, (float)TILE_SIZE, (float)TILE_SIZE};
-            }
-        }
-        std::vector<Rect> rooms;
-        for (int i = 0; i < 15; ++i) {
-            int w = 6 + rand() % 6, h = 6 + rand() % 6, x = 1 + rand() % (MAP_WIDTH - w - 1), y = 1 + rand() % (MAP_HEIGHT - h - 1);
-            Rect r = {(float)x, (float)y, (float)w, (float)h};
-            bool ok = true;
-            for (const auto& ex : rooms) if (r.intersects({ex.x - 1, ex.y - 1, ex.w + 2, ex.h + 2})) { ok = false; break; }
-            if (ok) {
-                rooms.push_back(r);
-                for (int ry = y; ry < y + h; ++ry) for (int rx = (int)x; rx < (int)x + w; ++rx) map[ry][rx].type = FLOOR;
-            }
-        }
-        for (size_t i = 1; i < rooms.size(); ++i) {
-            Vec2 p1 = rooms[i - 1].center(), p2 = rooms[i].center();
-            int xDir = (p2.x > p1.x) ? 1 : -1; for (int x = (int)p1.x; x != (int)p2.x; x += xDir) map[(int)p1.y][x].type = FLOOR;
-            int yDir = (p2.y > p1.y) ? 1 : -1; for (int y = (int)p1.y; y != (int)p2.y; y += yDir) map[y][(int)p2.x].type = FLOOR;
-        }
-        if (rooms.empty()) continue;
-        std::vector<std::vector<bool>> reachable(MAP_HEIGHT, std::vector<bool>(MAP_WIDTH, false));
-        std::queue<std::pair<int, int>> q; Vec2 start = rooms[0].center(); q.push({(int)start.x, (int)start.y}); reachable[(int)start.y][(int)start.x] = true;
-        while (!q.empty()) {
-            auto cur = q.front(); q.pop();
-            int dx[] = {0, 0, 1, -1}, dy[] = {1, -1, 0, 0};
-            for (int i = 0; i < 4; ++i) {
-                int nx = cur.first + dx[i], ny = cur.second + dy[i];
-                if (nx >= 0 && nx < MAP_WIDTH && ny >= 0 && ny < MAP_HEIGHT && map[ny][nx].type == FLOOR && !reachable[ny][nx]) { reachable[ny][nx] = true; q.push({nx, ny}); }
-            }
-        }
-        connected = true;
-        for (int y = 0; y < MAP_HEIGHT; ++y) for (int x = 0; x < MAP_WIDTH; ++x) if (map[y][x].type == FLOOR && !reachable[y][x]) connected = false;
-        
-        if (connected) {
-            for (int y = 0; y < MAP_HEIGHT; ++y) {
-                for (int x = 0; x < MAP_WIDTH; ++x) {
-                    if (map[y][x].type == FLOOR && rand() % 100 < 2) map[y][x].type = HAZARD_TILE;
-                }
-            }
+static bool outsideWindow(const Entity* e) {
+    Vec2 c = e->bounds.center();
+    return c.x < TILE_SIZE || c.y < TILE_SIZE || c.x >= (MAP_WIDTH - 1) * TILE_SIZE || c.y >= (MAP_HEIGHT - 1) * TILE_SIZE;
+}
+
+template <typename T, typename Pred>
+static void transferIf(std::vector<T*>& from, std::vector<T*>& to, Pred pred) {
+    from.erase(std::remove_if(from.begin(), from.end(), [&](T* e) { if (!pred(e)) return false; to.push_back(e); return true; }), from.end());
+}
+
+template <typename T, typename Pred>
+static void destroyIf(Arena& arena, std::vector<T*>& from, Pred pred) {
+    from.erase(std::remove_if(from.begin(), from.end(), [&](T* e) { if (!pred(e)) return false; arena.destroy(e); return true; }), from.end());
+}
+
+// Whole chunks between window-relative chunk (wx, wy) and the window; 0 inside it
+static int chunksOutside(int wx, int wy) {
+    return std::max({0, -wx, wx - (ChunkedWorld::WINDOW_W - 1), -wy, wy - (ChunkedWorld::WINDOW_H - 1)});
+}
+
+// Endurance: the map is a window of whole chunks. When the player leaves the middle chunks the window
+// slides by a whole number of chunks and everything shifts the other way (floating origin), so
+// positions, paths and the collision map all stay window-local and small however far the run goes.
+void Game::streamWorld() {
+    PROFILE_SCOPE("stream");
+    const float chunkPx = ChunkedWorld::CHUNK * TILE_SIZE;
+    Vec2 pc = p->bounds.center();
+    int pcx = (int)std::floor(pc.x / chunkPx), pcy = (int)std::floor(pc.y / chunkPx);
+    if (pcx >= 1 && pcx <= ChunkedWorld::WINDOW_W - 2 && pcy >= 1 && pcy <= ChunkedWorld::WINDOW_H - 2) return;
+    // A slide is a load event that may grow containers; the allocation guard re-arms after a fresh warm-up
+    Profiler::get().guardAllocs(false); steadyTicks = 0;
+    int dcx = pcx - ChunkedWorld::WINDOW_W / 2, dcy = pcy - ChunkedWorld::WINDOW_H / 2;
+    worldCx += dcx; worldCy += dcy;
+    world.fillWindow(worldCx, worldCy, map);
+
+    Vec2 d = {-dcx * chunkPx, -dcy * chunkPx};
+    auto shift = [&](Entity* e) { e->pos = e->pos + d; e->prevPos = e->prevPos + d; e->bounds.x += d.x; e->bounds.y += d.y; };
+    shift(p);
+    for (auto c : cores) { shift(c); for (auto& pt : c->path) pt = pt + d; }
+    for (auto c : dormantCores) shift(c);
+    for (auto s : slugs) { shift(s); for (int i = 0; i < s->tail.size(); ++i) s->tail[i] = s->tail[i] + d; }
+    for (auto e : echoes) shift(e);
+    for (auto i : items) shift(i);
+    for (auto i : dormantItems) shift(i);
+    for (auto dc : decorations) shift(dc);
+    for (auto dc : dormantDecorations) shift(dc);
+    for (auto& pt : vfx.particles) pt.pos = pt.pos + d;
+    for (int i = 0; i < fTexts.size(); ++i) fTexts[i].pos = fTexts[i].pos + d;
+    cam = cam + d; prevCam = prevCam + d;
+
+    // Whatever fell off the window goes dormant; in-flight slugs and echoes simply expire
+    transferIf(cores, dormantCores, [&](RogueCore* c) {
+        if (!outsideWindow(c)) return false;
+        aiSched.cancel(c); c->path.clear(); c->vel = {0, 0}; coreStats.remove(c);
+        return true;
+    });
+    transferIf(items, dormantItems, outsideWindow);
+    transferIf(decorations, dormantDecorations, outsideWindow);
+    // Memory follows the view, not the distance travelled: past DORMANT_CHUNKS the dormant entities are
+    // freed and the explored keys forgotten. A forgotten chunk rolls the same population again.
+    auto beyondRetention = [&](const Entity* e) {
+        Vec2 c = e->bounds.center();
+        return chunksOutside((int)std::floor(c.x / chunkPx), (int)std::floor(c.y / chunkPx)) > DORMANT_CHUNKS;
+    };
+    destroyIf(arena, dormantCores, beyondRetention);
+    destroyIf(arena, dormantItems, beyondRetention);
+    destroyIf(arena, dormantDecorations, beyondRetention);
+    visitedChunks.erase(std::remove_if(visitedChunks.begin(), visitedChunks.end(), [&](uint64_t k) {
+        return chunksOutside((int32_t)(k >> 32) - worldCx, (int32_t)(uint32_t)k - worldCy) > DORMANT_CHUNKS;
+    }), visitedChunks.end());
+    for (auto s : slugs) if (outsideWindow(s)) s->active = false;
+    for (auto e : echoes) if (outsideWindow(e)) e->active = false;
+    wakeDormant();
+    // Drone targets may have gone dormant; they pick a new one on their next think
+    for (auto c : cores) if (auto dr = dynamic_cast<RepairDrone*>(c)) dr->target = nullptr;
+    for (auto c : dormantCores) if (auto dr = dynamic_cast<RepairDrone*>(c)) dr->target = nullptr;
+
+    for (int wy = 0; wy < ChunkedWorld::WINDOW_H; ++wy) for (int wx = 0; wx < ChunkedWorld::WINDOW_W; ++wx) {
+        uint64_t key = ChunkedWorld::chunkKey(worldCx + wx, worldCy + wy);
+        auto it = std::lower_bound(visitedChunks.begin(), visitedChunks.end(), key);
+        if (it != visitedChunks.end() && *it == key) continue;
+        visitedChunks.insert(it, key);
+        spawnInChunk(wx, wy);
+    }
+}
+
+// First visit to a chunk rolls its population; later visits find whatever was left there. The roll
+// comes from the world seed, so a chunk that streamWorld has forgotten repopulates the same way.
+void Game::spawnInChunk(int wx, int wy) {
+    Rng rng(world.chunkSeed(worldCx + wx, worldCy + wy) ^ 0x5EED5EED5EED5EEDull); // Apart from the chunk's tile stream
+    auto floorTile = [&](Vec2& at, float size) {
+        for (int i = 0; i < 16; ++i) {
+            int x = wx * ChunkedWorld::CHUNK + 1 + rng.next() % (ChunkedWorld::CHUNK - 2), y = wy * ChunkedWorld::CHUNK + 1 + rng.next() % (ChunkedWorld::CHUNK - 2);
+            if (map[y][x].type != FLOOR) continue;
+            at = {x * TILE_SIZE + (TILE_SIZE - size) / 2, y * TILE_SIZE + (TILE_SIZE - size) / 2};
+            return true;
         }
+        return false;
+    };
+    // A forgotten chunk rolls its items again but never its core; the draws are made either way so the
+    // item roll stays the same
+    uint64_t key = ChunkedWorld::chunkKey(worldCx + wx, worldCy + wy);
+    auto spent = std::lower_bound(coreChunks.begin(), coreChunks.end(), key);
+    Vec2 at;
+    if (rng.next() % 100 < 30 + sector * 5 && floorTile(at, 28) && (spent == coreChunks.end() || *spent != key)) {
+        cores.push_back(arena.make<RogueCore>(at)); coreStats.add(cores.back());
+        coreChunks.insert(spent, key);
+    }
+    if (rng.next() % 100 < 10 && floorTile(at, 20)) items.push_back(arena.make<Item>(at, (rng.next() % 100 < 40) ? ItemType::BATTERY_PACK : ItemType::REPAIR_KIT));
+}
+
+void Game::wakeDormant() {
+    transferIf(dormantItems, items, [](Item* i) { return !outsideWindow(i); });
+    transferIf(dormantDecorations, decorations, [](Entity* dc) { return !outsideWindow(dc); });
+    transferIf(dormantCores, cores, [&](RogueCore* c) { if (outsideWindow(c) || !placeOnFloor(c)) return false; coreStats.add(c); return true; });
+}
+
+// Coarse simulation for dormant cores: once per DORMANT_STEP they close in on the player in a straight
+// line at reduced speed, ignoring walls, and rejoin the full simulation when they reach the window.
+void Game::updateDormant(float dt) {
+    dormantTimer += dt;
+    if (dormantTimer < DORMANT_STEP) return;
+    dormantTimer -= DORMANT_STEP;
+    Vec2 pc = p->bounds.center();
+    for (auto c : dormantCores) {
+        if (c->sanitized || c->contained) continue;
+        c->stunTimer = std::max(0.0f, c->stunTimer - DORMANT_STEP);
+        Vec2 step = (pc - c->bounds.center()).normalized() * (AI_SPEED * DORMANT_SPEED * DORMANT_STEP);
+        c->pos = c->pos + step; c->prevPos = c->pos; c->bounds.x = c->pos.x; c->bounds.y = c->pos.y;
     }
+    wakeDormant();
 }
 
 void Game::handleInput() {
-    input.update();
-    if (input.isTriggered(SDL_SCANCODE_F1)) { 
+    PROFILE_SCOPE("handleInput");
+    if (input.quitRequested) { running = false; return; }
+    if (input.isTriggered(Action::DEV_MODE)) { 
         debugMode = !debugMode; hud.addLog(debugMode ? "DEV MODE: ON" : "DEV MODE: OFF", COL_GOLD); 
         audio.play(SoundType::UI_CLICK, 0.3f, 800.0f);
     }
-    if (debugMode && input.isTriggered(SDL_SCANCODE_F2)) { sector++; init(); return; }
-    if (input.isTriggered(SDL_SCANCODE_SPACE) && state == GameState::PLAYING) { 
+    if (input.isTriggered(Action::PROFILER)) showProfiler = !showProfiler;
+    if (input.isTriggered(Action::TRACE_EXPORT)) {
+        hud.addLog(Profiler::get().writeChromeTrace("recoil_trace.json") ? "PROFILER: Trace written." : "PROFILER: Trace export failed.", COL_GOLD);
+    }
+    if (debugMode && input.isTriggered(Action::DEV_SKIP)) { sector++; init(); return; }
+    if (debugMode && input.isTriggered(Action::SNAPSHOT_SAVE) && state == GameState::PLAYING) {
+        hud.addLog(saveSnapshotFile("recoil_snapshot.bin") ? "SNAPSHOT: Saved." : "SNAPSHOT: Save failed.", COL_GOLD);
+    }
+    if (debugMode && input.isTriggered(Action::SNAPSHOT_LOAD)) {
+        hud.addLog(loadSnapshotFile("recoil_snapshot.bin") ? "SNAPSHOT: Restored." : "SNAPSHOT: Load failed.", COL_GOLD);
+        return;
+    }
+    if (input.isTriggered(Action::REFLEX) && state == GameState::PLAYING) { 
         p->reflexActive = !p->reflexActive; hud.addLog(p->reflexActive ? "REFLEX: ON" : "REFLEX: OFF"); 
         audio.play(SoundType::UI_CONFIRM, 0.4f, 400.0f);
     }
-    if (input.isPressed(SDL_SCANCODE_1) && currentAmmo != AmmoType::STANDARD) { currentAmmo = AmmoType::STANDARD; audio.play(SoundType::UI_CLICK, 0.2f, 600.0f); }
-    if (input.isPressed(SDL_SCANCODE_2) && currentAmmo != AmmoType::EMP) { currentAmmo = AmmoType::EMP; audio.play(SoundType::UI_CLICK, 0.2f, 700.0f); }
-    if (input.isPressed(SDL_SCANCODE_3) && currentAmmo != AmmoType::PIERCING) { currentAmmo = AmmoType::PIERCING; audio.play(SoundType::UI_CLICK, 0.2f, 800.0f); }
-    if (input.isTriggered(SDL_SCANCODE_R) && state == GameState::PLAYING) {
+    if (input.isPressed(Action::AMMO_STANDARD) && currentAmmo != AmmoType::STANDARD) { currentAmmo = AmmoType::STANDARD; audio.play(SoundType::UI_CLICK, 0.2f, 600.0f); }
+    if (input.isPressed(Action::AMMO_EMP) && currentAmmo != AmmoType::EMP) { currentAmmo = AmmoType::EMP; audio.play(SoundType::UI_CLICK, 0.2f, 700.0f); }
+    if (input.isPressed(Action::AMMO_PIERCING) && currentAmmo != AmmoType::PIERCING) { currentAmmo = AmmoType::PIERCING; audio.play(SoundType::UI_CLICK, 0.2f, 800.0f); }
+    if (input.isTriggered(Action::RELOAD) && state == GameState::PLAYING) {
         int n = p->maxSlugs - p->slugs;
         if (n > 0 && p->reserveSlugs > 0) {
             int a = std::min(n, p->reserveSlugs); p->slugs += a; p->reserveSlugs -= a; shake = 5.0f; hud.addLog("WEAPON: Slugs reloaded.");
@@ -171,21 +311,24 @@ void Game::handleInput() {
             audio.play(SoundType::EMPTY, 0.4f, 150.0f);
         }
     }
-    if (input.isPressed(SDL_SCANCODE_F) && p->energy > 50.0f) {
+    if (input.isPressed(Action::PULSE) && p->energy > 50.0f) {
         p->energy -= 50.0f; vfx.triggerFlash(0.5f);
         audio.play(SoundType::POWERUP, 0.4f, 600.0f);
-        for (auto s : slugs) if (!s->isPlayer && s->pos.distance(p->pos) < 250.0f) s->active = false;
-        for (auto c : cores) if (c->pos.distance(p->pos) < 200.0f) { c->stability -= 150.0f; Vec2 d = (c->pos - p->pos).normalized(); if (d.length() < 0.1f) d = {0, -1}; c->vel = d * 1200.0f; c->stunTimer = 0.8f; }
+        for (auto s : slugs) if (!s->isPlayer && s->pos.withinRadius(p->pos, 250.0f)) s->active = false;
+        for (auto c : cores) if (c->pos.withinRadius(p->pos, 200.0f)) { c->stability -= 150.0f; Vec2 d = (c->pos - p->pos).normalized(); if (d.length() < 0.1f) d = {0, -1}; c->vel = d * 1200.0f; c->stunTimer = 0.8f; }
     }
-    if (input.isPressed(SDL_SCANCODE_LSHIFT) && p->energy > 30.0f) {
+    if (input.isPressed(Action::DASH) && p->energy > 30.0f) {
         Vec2 d = p->vel.normalized(); if (d.length() < 0.1f) d = {0, -1};
         p->vel = d * DASH_SPEED; p->dashTimer = 0.15f; p->energy -= 30.0f;
         audio.play(SoundType::DASH, 0.3f, 200.0f);
     }
-    if (input.isPressed(SDL_SCANCODE_RETURN)) {
+    if (input.isPressed(Action::CONFIRM)) {
         if (state == GameState::SUMMARY) {
-            sector++; SaveData sd = {sector, score, p->suitIntegrity}; saveProgress(sd);
-            audio.play(SoundType::UI_CONFIRM, 0.5f, 400.0f); init();
+            sector++; if (!replaying) saveProgress();
+            audio.play(SoundType::UI_CONFIRM, 0.5f, 400.0f);
+            cleanup();
+            if (nextPlan.sector != sector || nextPlan.seed != nextSectorSeed) { nextPlan.sector = sector; nextPlan.seed = nextSectorSeed; SectorGen::build(nextPlan); }
+            startSector(nextPlan);
         } else if (state != GameState::PLAYING) {
             audio.play(SoundType::UI_CONFIRM, 0.5f, 300.0f); init();
         }
@@ -193,135 +336,152 @@ void Game::handleInput() {
 }
 
 void Game::update() {
+    PROFILE_SCOPE("update");
     if (state != GameState::PLAYING) return;
-    float dt = FRAME_DELAY / 1000.0f; float ts = p->reflexActive ? REFLEX_SCALE : 1.0f; float wdt = dt * ts;
+#ifdef RECOIL_ASSERT_NO_ALLOCS
+    // Containers have grown to their working size by now, so a steady-state tick must not allocate
+    struct AllocGuard {
+        explicit AllocGuard(bool on) { Profiler::get().guardAllocs(on); }
+        ~AllocGuard() { Profiler::get().guardAllocs(false); }
+    } allocGuard(steadyTicks >= ALLOC_WARMUP_TICKS);
+#endif
+    steadyTicks++;
+    storePrevState();
+    float dt = SIM_DT; float ts = p->reflexActive ? REFLEX_SCALE : 1.0f; float wdt = dt * ts;
     if (shake > 0) shake -= 20.0f * dt;
     if (multiplierTimer > 0) multiplierTimer -= dt; else multiplier = 1.0f;
     if (titleTimer > 0) titleTimer -= dt;
+    los.beginFrame();
 
     if (p->dashTimer <= 0) {
         Vec2 mv = {0, 0};
-        if (input.isPressed(SDL_SCANCODE_W)) mv.y = -1;
-        if (input.isPressed(SDL_SCANCODE_S)) mv.y = 1;
-        if (input.isPressed(SDL_SCANCODE_A)) mv.x = -1;
-        if (input.isPressed(SDL_SCANCODE_D)) mv.x = 1;
+        if (input.isPressed(Action::MOVE_UP)) mv.y = -1;
+        if (input.isPressed(Action::MOVE_DOWN)) mv.y = 1;
+        if (input.isPressed(Action::MOVE_LEFT)) mv.x = -1;
+        if (input.isPressed(Action::MOVE_RIGHT)) mv.x = 1;
         p->vel = mv.normalized() * PLAYER_SPEED;
         if (mv.length() > 0.1f) {
             p->stepTimer -= dt;
-            if (p->stepTimer <= 0) { audio.play(SoundType::STEP, 0.15f, 100.0f); p->stepTimer = 0.35f; }
+            if (p->stepTimer <= 0) { events.sound(SoundType::STEP, 0.15f, 100.0f); p->stepTimer = 0.35f; }
         } else { p->stepTimer = 0; }
     }
-    Vec2 pCtr = p->bounds.center(); Vec2 mWorld = input.mPos + cam; p->lookAngle = std::atan2(mWorld.y - pCtr.y, mWorld.x - pCtr.x);
+    Vec2 pCtr = p->bounds.center(); Vec2 mWorld = input.mPos + cam; p->lookAngle = FastMath::atan2(mWorld.y - pCtr.y, mWorld.x - pCtr.x);
     p->update(dt, map); objective.update(*this); hud.update(dt);
     if (p->shield >= p->maxShield && p->prevShield < p->maxShield) {
-        audio.play(SoundType::READY, 0.3f, 800.0f);
+        events.sound(SoundType::READY, 0.3f, 800.0f);
     }
     
     int px = (int)(p->bounds.center().x / TILE_SIZE), py = (int)(p->bounds.center().y / TILE_SIZE);
     if (px >= 0 && px < MAP_WIDTH && py >= 0 && py < MAP_HEIGHT && map[py][px].type == HAZARD_TILE) {
         damagePlayer(15.0f * dt);
-        if (rand() % 20 == 0) {
-            audio.play(SoundType::ZAP, 0.2f, 800.0f + (rand() % 400));
-            vfx.spawnBurst(p->bounds.center(), 3, {255, 255, 0, 255});
+        if (gameRand() % 20 == 0) {
+            events.sound(SoundType::ZAP, 0.2f, 800.0f + (gameRand() % 400));
+            events.burst(p->bounds.center(), 3, {255, 255, 0, 255});
         }
     }
 
-    bool bossActive = false;
-    bool enemiesClose = false;
-    for (auto c : cores) {
-        if (dynamic_cast<FinalBossCore*>(c) && !c->sanitized) bossActive = true;
-        if (!c->sanitized && c->pos.distance(p->pos) < 350.0f) enemiesClose = true;
-    }
-    if (bossActive) audio.setAmbientState(AmbientState::BOSS);
-    else if (enemiesClose) audio.setAmbientState(AmbientState::BATTLE);
+    // One distance pass over every core answers this tick's proximity questions: ambient, radar pulse and AI.
+    // Sanitized cores are parked far away so the pass's running minimum is the nearest live core.
+    coreProx.build((int)cores.size(), [this](int i) { return cores[i]->sanitized ? ProximitySet::farPoint() : cores[i]->bounds.center(); });
+    float minCDistSq = coreProx.measure(p->bounds.center());
+    if (coreStats.boss) audio.setAmbientState(AmbientState::BOSS);
+    else if (minCDistSq < 350.0f * 350.0f) audio.setAmbientState(AmbientState::BATTLE);
     else audio.setAmbientState(AmbientState::STANDARD);
 
     if (p->suitIntegrity < 30.0f) {
         alertTimer -= dt;
-        if (alertTimer <= 0) { audio.play(SoundType::ALERT, 0.2f, 1000.0f); alertTimer = 0.6f; }
+        if (alertTimer <= 0) { events.sound(SoundType::ALERT, 0.2f, 1000.0f); alertTimer = 0.6f; }
     }
     
-    float minCDist = 9999.0f;
-    for (auto c : cores) if (!c->sanitized) minCDist = std::min(minCDist, c->pos.distance(p->pos));
+    float minCDist = std::sqrt(minCDistSq);
     if (minCDist < 250.0f) {
         pulseTimer -= dt;
         if (pulseTimer <= 0) {
-            audio.play(SoundType::UI_CLICK, 0.1f, 100.0f + (250.0f - minCDist));
+            events.sound(SoundType::UI_CLICK, 0.1f, 100.0f + (250.0f - minCDist));
             pulseTimer = 0.4f + (minCDist / 500.0f);
         }
     }
 
     if (p->energy < 20.0f) {
         energyAlertTimer -= dt;
-        if (energyAlertTimer <= 0) { audio.play(SoundType::LOW_ENERGY, 0.15f, 1500.0f); energyAlertTimer = 1.0f; }
+        if (energyAlertTimer <= 0) { events.sound(SoundType::LOW_ENERGY, 0.15f, 1500.0f); energyAlertTimer = 1.0f; }
     }
     if (debugMode) { p->suitIntegrity = 100.0f; p->energy = 100.0f; p->slugs = p->maxSlugs; }
-    updatePickups(); updateWeapons(wdt); updateAI(wdt); updateSlugs(wdt); updateEchoes(wdt);
+    updatePickups(); updateWeapons(wdt); updateAI(wdt);
+    simulate(dt, wdt); flushEvents();
+    updateSlugs(); resolveAI(); updateEchoes(wdt);
     for (auto d : decorations) {
         float oldTimer = dynamic_cast<DecorativeMachine*>(d)->timer;
         d->update(dt, map);
         if (oldTimer > 0 && dynamic_cast<DecorativeMachine*>(d)->timer > oldTimer) {
             SoundType st = dynamic_cast<DecorativeMachine*>(d)->sound;
             float f = (st == SoundType::DRIP) ? 1200.0f : (st == SoundType::STEAM ? 400.0f : 60.0f);
-            playSpatial(st, d->pos, 0.25f, f);
-            if (st == SoundType::STEAM) vfx.spawnBurst(d->pos, 10, {200, 200, 255, 150});
+            events.spatial(st, d->pos, 0.25f, f);
+            if (st == SoundType::STEAM) events.burst(d->pos, 10, {200, 200, 255, 150});
         }
     }
-    for (auto& ft : fTexts) { ft.pos.y -= 40.0f * dt; ft.life -= dt; }
-    fTexts.erase(std::remove_if(fTexts.begin(), fTexts.end(), [](const FloatingText& t) { return t.life <= 0; }), fTexts.end());
+    for (int i = 0; i < fTexts.size(); ++i) { fTexts[i].pos.y -= 40.0f * dt; fTexts[i].life -= dt; }
+    while (!fTexts.empty() && fTexts.front().life <= 0) fTexts.popFront();
     if (exit && exit->active && p->bounds.intersects(exit->bounds)) {
         state = GameState::SUMMARY;
-        audio.play(SoundType::UI_CONFIRM, 0.6f, 500.0f);
+        planNextSector();
+        events.sound(SoundType::UI_CONFIRM, 0.6f, 500.0f);
+        drainEvents();
         return;
     }
     Vec2 tCam = p->bounds.center() - Vec2(SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2); cam.x += (tCam.x - cam.x) * 6.0f * dt; cam.y += (tCam.y - cam.y) * 6.0f * dt;
-    if (shake >= 1.0f) { cam.x += (rand() % (int)shake) - (int)shake / 2; cam.y += (rand() % (int)shake) - (int)shake / 2; }
-    lighting.update(p->bounds.center(), map); vfx.update(dt);
+    if (endurance) { streamWorld(); updateDormant(dt); }
+    if (shake >= 1.0f) { cam.x += (gameRand() % (int)shake) - (int)shake / 2; cam.y += (gameRand() % (int)shake) - (int)shake / 2; }
     if (p->suitIntegrity <= 0) { 
         state = GameState::GAME_OVER; 
-        audio.play(SoundType::BOSS_PHASE, 0.8f, 50.0f); 
-        hud.addLog("CRITICAL: SUIT INTEGRITY TERMINATED", {255, 50, 50, 255});
+        events.sound(SoundType::BOSS_PHASE, 0.8f, 50.0f); 
+        events.log("CRITICAL: SUIT INTEGRITY TERMINATED", {255, 50, 50, 255});
     }
+    drainEvents();
 }
 
 void Game::updateWeapons(float dt) {
-    (void)dt;
-    if (input.mDown && p->shootCooldown <= 0) {
+    if (input.isPressed(Action::FIRE) && p->shootCooldown <= 0) {
         if (p->slugs > 0) {
             Vec2 d = (input.mPos + cam - p->bounds.center()).normalized();
-            slugs.push_back(new KineticSlug(p->bounds.center(), d * 800.0f, true, currentAmmo));
+            slugs.push_back(arena.make<KineticSlug>(p->bounds.center(), d * 800.0f, true, currentAmmo));
+            // A fresh click fires at its sub-tick time: the slug only travels for the rest of the tick
+            if (input.isTriggered(Action::FIRE)) slugs.back()->spawnDelay = input.pressOffset(Action::FIRE) * dt;
             p->shootCooldown = 0.25f; p->slugs--; shake = 3.0f;
-            if (currentAmmo == AmmoType::EMP) audio.play(SoundType::EMP_SHOT, 0.4f, 800.0f);
-            else if (currentAmmo == AmmoType::PIERCING) audio.play(SoundType::PIERCE_SHOT, 0.5f, 400.0f);
-            else audio.play(SoundType::SHOOT, 0.35f, 1200.0f + (rand() % 200), 0.0f);
+            if (currentAmmo == AmmoType::EMP) events.sound(SoundType::EMP_SHOT, 0.4f, 800.0f);
+            else if (currentAmmo == AmmoType::PIERCING) events.sound(SoundType::PIERCE_SHOT, 0.5f, 400.0f);
+            else events.sound(SoundType::SHOOT, 0.35f, 1200.0f + (gameRand() % 200));
         } else {
             p->shootCooldown = 0.25f;
-            audio.play(SoundType::EMPTY, 0.3f, 200.0f);
+            events.sound(SoundType::EMPTY, 0.3f, 200.0f);
         }
     }
 }
 
-void Game::playSpatial(SoundType type, Vec2 pos, float vol, float freq) {
+// Distance falloff and pan for a sound at pos; false if out of earshot
+bool Game::spatialize(Vec2 pos, float& vol, float& pan) {
     Vec2 d = pos - p->bounds.center();
     float dist = d.length();
-    if (dist > 800.0f) return;
-    float pan = std::clamp(d.x / 400.0f, -1.0f, 1.0f);
+    if (dist > 800.0f) return false;
+    pan = std::clamp(d.x / 400.0f, -1.0f, 1.0f);
     float falloff = std::max(0.0f, 1.0f - (dist / 800.0f));
-    audio.play(type, vol * falloff, freq, pan);
+    if (!los.visible(pos, p->bounds.center(), map)) falloff *= 0.35f; // Occluded by walls
+    vol *= falloff;
+    return true;
 }
 
 void Game::damagePlayer(float amount) {
     if (p->shield > 0) {
         p->shield -= amount;
         if (p->shield <= 0) {
-            audio.play(SoundType::SHIELD_DOWN, 0.5f, 400.0f);
-            spawnFText(p->pos, "SHIELD COLLAPSED", {100, 200, 255, 255});
+            events.sound(SoundType::SHIELD_DOWN, 0.5f, 400.0f);
+            events.text(p->pos, "SHIELD COLLAPSED", {100, 200, 255, 255});
         } else {
-            audio.play(SoundType::HIT, 0.2f, 800.0f);
+            events.sound(SoundType::HIT, 0.2f, 800.0f);
         }
     } else {
         p->suitIntegrity -= amount;
-        audio.play(SoundType::HIT, 0.4f, 200.0f);
+        events.sound(SoundType::HIT, 0.4f, 200.0f);
         shake = 8.0f;
     }
 }
@@ -332,90 +492,156 @@ void Game::updatePickups() {
             i->active = false;
             if (i->it == ItemType::REPAIR_KIT) { 
                 p->suitIntegrity = std::min(100.0f, p->suitIntegrity + 30.0f); 
-                spawnFText(i->pos, "REPAIRED", {50, 255, 50, 255});
-                playSpatial(SoundType::PICKUP, i->pos, 0.4f, 600.0f);
+                events.text(i->pos, "REPAIRED", {50, 255, 50, 255});
+                events.spatial(SoundType::PICKUP, i->pos, 0.4f, 600.0f);
             }
             else if (i->it == ItemType::BATTERY_PACK) { 
                 p->reserveSlugs += 24; 
-                spawnFText(i->pos, "+24 SLUGS", COL_GOLD);
-                playSpatial(SoundType::PICKUP, i->pos, 0.4f, 800.0f);
+                events.text(i->pos, "+24 SLUGS", COL_GOLD);
+                events.spatial(SoundType::PICKUP, i->pos, 0.4f, 800.0f);
             }
             else if (i->it == ItemType::COOLANT) {
                 p->energy = std::min(100.0f, p->energy + 50.0f);
-                spawnFText(i->pos, "ENERGY RESTORED", {100, 100, 255, 255});
-                playSpatial(SoundType::POWERUP, i->pos, 0.5f, 1000.0f);
+                events.text(i->pos, "ENERGY RESTORED", {100, 100, 255, 255});
+                events.spatial(SoundType::POWERUP, i->pos, 0.5f, 1000.0f);
             }
             else if (i->it == ItemType::OVERCLOCK) {
                 p->reflexMeter = 100.0f;
-                spawnFText(i->pos, "SYSTEM OVERCLOCKED", COL_GOLD);
-                playSpatial(SoundType::POWERUP, i->pos, 0.6f, 1200.0f);
+                events.text(i->pos, "SYSTEM OVERCLOCKED", COL_GOLD);
+                events.spatial(SoundType::POWERUP, i->pos, 0.6f, 1200.0f);
             }
-            vfx.spawnBurst(i->pos, 15, COL_GOLD);
+            events.burst(i->pos, 15, COL_GOLD);
         }
     }
-    items.erase(std::remove_if(items.begin(), items.end(), [](Item* i) { if (!i->active) { delete i; return true; } return false; }), items.end());
+    items.erase(std::remove_if(items.begin(), items.end(), [this](Item* i) { if (!i->active) { arena.destroy(i); return true; } return false; }), items.end());
 }
 
 void Game::updateAI(float dt) {
-    std::vector<RogueCore*> newSpawns;
-    for (auto c : cores) {
+    PROFILE_SCOPE("updateAI");
+    movers.clear();
+    const float stunDecay = std::pow(0.1f, dt);
+    // Cores have not moved since update() measured coreProx
+    for (size_t i = 0; i < cores.size(); ++i) {
+        RogueCore* c = cores[i];
         if (!c->active || c->sanitized) continue;
-        Vec2 dirToPlayer = p->bounds.center() - c->bounds.center(); c->lookAngle = std::atan2(dirToPlayer.y, dirToPlayer.x);
+        float d = std::sqrt(coreProx.d2[i]);
+        bool think = aiSched.shouldThink(c, d, dt);
+        if (think) { Vec2 dirToPlayer = p->bounds.center() - c->bounds.center(); c->lookAngle = FastMath::atan2(dirToPlayer.y, dirToPlayer.x); }
         RepairDrone* dr = dynamic_cast<RepairDrone*>(c);
         if (dr) {
-            if (!dr->target) {
+            if (!dr->target && think) {
                 float ms = 101.0f;
                 for (auto tc : cores) if (tc->active && !tc->sanitized && !tc->contained && tc->stability < ms && tc->type == EntityType::ROGUE_CORE) { ms = tc->stability; dr->target = tc; }
             }
             if (dr->target) {
                 Vec2 dir = (dr->target->pos - dr->pos);
-                if (dir.length() < 40.0f) { dr->target->stability = std::min(100.0f, dr->target->stability + dr->repairPower * dt); dr->vel = {0, 0}; }
+                if (dir.lengthSq() < 40.0f * 40.0f) { dr->target->stability = std::min(100.0f, dr->target->stability + dr->repairPower * dt); dr->vel = {0, 0}; }
                 else dr->vel = dir.normalized() * 180.0f;
             }
-            dr->update(dt, map); continue;
+            movers.push_back(dr); continue;
         }
         FinalBossCore* bs = dynamic_cast<FinalBossCore*>(c);
         if (bs && !bs->contained) {
             bs->phaseTimer += dt;
             if (bs->phase == 1 && bs->stability < 1000.0f) { 
-                bs->phase = 2; hud.addLog("BOSS: Shielding protocol engaged!", {255, 0, 255, 255}); 
-                audio.play(SoundType::BOSS_PHASE, 0.7f, 100.0f);
+                bs->phase = 2; events.log("BOSS: Shielding protocol engaged!", {255, 0, 255, 255}); 
+                events.sound(SoundType::BOSS_PHASE, 0.7f, 100.0f);
             }
-            if (bs->phase == 2 && rand() % 200 == 0) newSpawns.push_back(new SeekerSwarm(bs->bounds.center()));
+            if (bs->phase == 2 && gameRand() % 200 == 0) pendingSpawns.push_back(arena.make<SeekerSwarm>(bs->bounds.center()));
         }
         if (c->contained) continue;
-        if (c->stunTimer > 0) { c->stunTimer -= dt; c->vel = c->vel * std::pow(0.1f, dt); c->update(dt, map); continue; }
-        float d = c->bounds.center().distance(p->bounds.center());
+        if (c->stunTimer > 0) { c->stunTimer -= dt; c->vel = c->vel * stunDecay; movers.push_back(c); continue; }
         if (d < 400) {
-            c->stateTimer -= dt; if (c->stateTimer <= 0) { c->calculatePath(p->bounds.center(), map); c->stateTimer = 0.5f; }
-            if (!c->path.empty() && c->pathIndex < c->path.size()) { Vec2 dir = (c->path[c->pathIndex] - c->bounds.center()); if (dir.length() < 10.0f) c->pathIndex++; else c->vel = dir.normalized() * AI_SPEED; }
+            c->stateTimer -= dt; if (c->stateTimer <= 0) { aiSched.requestReplan(c, d); c->stateTimer = 0.5f; }
+            if (!c->path.empty() && c->pathIndex < c->path.size()) { Vec2 dir = (c->path[c->pathIndex] - c->bounds.center()); if (dir.lengthSq() < 10.0f * 10.0f) c->pathIndex++; else c->vel = dir.normalized() * AI_SPEED; }
+        }
+        if (think && d < 250 && gameRand() % 100 < 2 && los.visible(c->bounds.center(), p->bounds.center(), map)) {
+            slugs.push_back(arena.make<KineticSlug>(c->bounds.center(), (p->bounds.center() - c->bounds.center()).normalized() * 450.0f, false));
+            events.spatial(SoundType::SHOOT, c->pos, 0.2f, 600.0f + (gameRand() % 100));
         }
-        if (d < 250 && rand() % 100 < 2) {
-            slugs.push_back(new KineticSlug(c->bounds.center(), (p->bounds.center() - c->bounds.center()).normalized() * 450.0f, false));
-            playSpatial(SoundType::SHOOT, c->pos, 0.2f, 600.0f + (rand() % 100));
+        movers.push_back(c);
+    }
+    aiSched.processReplans(p->bounds.center(), map);
+}
+
+// Parallel phase: movement and map collision only. Anything with side effects is recorded
+// into per-chunk event buffers and applied by flushEvents() in chunk order.
+void Game::simulate(float dt, float wdt) {
+    PROFILE_SCOPE("simulate");
+    const int coreGrain = 16, slugGrain = 32, particleGrain = 256;
+    int slugCount = (int)slugs.size();
+    chunkEvents.resize(std::max(chunkEvents.size(), (size_t)JobSystem::chunkCount(slugCount, slugGrain)));
+    auto moveCores = [&](int b, int e) { for (int i = b; i < e; ++i) movers[i]->update(wdt, map); };
+    auto moveSlugs = [&](int b, int e) {
+        EventBus& ev = chunkEvents[b / slugGrain];
+        for (int i = b; i < e; ++i) {
+            KineticSlug* s = slugs[i];
+            if (!s->active) continue;
+            int oldBounces = s->bounces;
+            s->update(wdt, map);
+            if (s->bounces < oldBounces) ev.spatial(SoundType::RICOCHET, s->pos, 0.15f, 1200.0f, 800);
         }
-        c->update(dt, map);
+    };
+    auto moveParticles = [&](int b, int e) { vfx.integrate(dt, b, e); };
+    Vec2 lightPos = p->bounds.center();
+    auto light = [&](int, int) { PROFILE_SCOPE("lighting.update"); lighting.update(lightPos, map); };
+    JobCounter counter;
+    jobs.dispatch(counter, 1, 1, light);
+    jobs.dispatch(counter, (int)movers.size(), coreGrain, moveCores);
+    jobs.dispatch(counter, slugCount, slugGrain, moveSlugs);
+    jobs.dispatch(counter, (int)vfx.particles.size(), particleGrain, moveParticles);
+    jobs.wait(counter);
+    vfx.finishUpdate(dt);
+}
+
+// Job buses join the tick's bus in chunk order, so the result does not depend on the thread count
+void Game::flushEvents() {
+    for (auto& ev : chunkEvents) { events.append(ev); ev.clear(); }
+}
+
+// Applies the tick's side effects. Same-type sounds merge into one voice, the loudest instance made
+// louder per repeat, so a burst of hits costs one voice instead of filling the pool. Runs headless too:
+// bursts and jitter draw from the sim RNG, and replays must draw the same.
+void Game::drainEvents() {
+    for (const auto& t : events.texts) fTexts.push({t.pos, t.text, 1.0f, t.color});
+    if (!events.texts.empty()) events.sound(SoundType::UI_CLICK, 0.15f, 1500.0f); // Popup cue
+    for (const auto& l : events.logs) hud.addLog(l.text, l.color);
+    for (const auto& b : events.bursts) vfx.spawnBurst(b.pos, b.count, b.color);
+    if (events.flash > 0.0f) vfx.triggerFlash(events.flash);
+    struct Voice { float vol = 0.0f, freq = 0.0f, pan = 0.0f; int n = 0; } voices[(int)SoundType::COUNT];
+    for (const auto& e : events.sounds) {
+        float vol = e.vol, pan = e.pan, freq = e.freq + (e.freqJitter > 0 ? (float)(gameRand() % e.freqJitter) : 0.0f);
+        if (e.spatial && !spatialize(e.pos, vol, pan)) continue;
+        Voice& v = voices[(int)e.type];
+        if (vol > v.vol || !v.n) { v.vol = vol; v.freq = freq; v.pan = pan; }
+        v.n++;
     }
-    for (auto n : newSpawns) cores.push_back(n);
-    cores.erase(std::remove_if(cores.begin(), cores.end(), [](RogueCore* c) { if (!c->active) { delete c; return true; } return false; }), cores.end());
+    for (int t = 0; t < (int)SoundType::COUNT; ++t) {
+        const Voice& v = voices[t];
+        if (v.n) audio.play((SoundType)t, std::min(1.0f, v.vol * (1.0f + SOUND_STACK_BOOST * std::min(v.n - 1, SOUND_STACK_MAX))), v.freq, v.pan);
+    }
+    events.clear();
+}
+
+void Game::resolveAI() {
+    for (auto n : pendingSpawns) { cores.push_back(n); coreStats.add(n); }
+    pendingSpawns.clear();
+    cores.erase(std::remove_if(cores.begin(), cores.end(), [this](RogueCore* c) { if (!c->active) { aiSched.cancel(c); coreStats.remove(c); arena.destroy(c); return true; } return false; }), cores.end());
     for (auto c : cores) if (c->contained && !c->sanitized && p->bounds.intersects(c->bounds)) { 
-        c->sanitized = true; score += (int)(150 * multiplier); multiplier += 0.2f; multiplierTimer = 3.0f;
-        spawnFText(c->pos, "SANITIZED x" + std::to_string(multiplier).substr(0,3), COL_PLAYER); 
-        vfx.spawnBurst(c->pos, 25, COL_PLAYER); 
-        playSpatial(SoundType::SANITIZE, c->pos, 0.5f, 400.0f);
-        audio.play(SoundType::UI_CLICK, 0.3f, 1000.0f + multiplier * 100.0f);
+        coreStats.sanitize(c); c->sanitized = true; score += (int)(150 * multiplier); multiplier += 0.2f; multiplierTimer = 3.0f;
+        char label[32]; int tenths = (int)(multiplier * 10.0f);
+        snprintf(label, sizeof(label), "SANITIZED x%d.%d", tenths / 10, tenths % 10);
+        events.text(c->pos, label, COL_PLAYER);
+        events.burst(c->pos, 25, COL_PLAYER); 
+        events.spatial(SoundType::SANITIZE, c->pos, 0.5f, 400.0f);
+        events.sound(SoundType::UI_CLICK, 0.3f, 1000.0f + multiplier * 100.0f);
     }
 }
 
-void Game::updateSlugs(float dt) {
+void Game::updateSlugs() {
+    PROFILE_SCOPE("updateSlugs");
     for (auto s : slugs) {
         if (!s->active) continue;
-        int oldBounces = s->bounces;
-        s->update(dt, map);
-        if (s->bounces < oldBounces) {
-            playSpatial(SoundType::RICOCHET, s->pos, 0.15f, 1200.0f + (rand() % 800));
-        }
-        
         if (s->isPlayer) {
             for (auto c : cores) if (c->active && !c->contained && s->bounds.intersects(c->bounds)) {
                 float dmg = 25.0f * s->powerMultiplier;
@@ -424,58 +650,280 @@ void Game::updateSlugs(float dt) {
                 GuardianCore* g = dynamic_cast<GuardianCore*>(c);
                 if (g && g->shield > 0) { 
                     g->shield -= dmg; 
-                    if (g->shield <= 0) playSpatial(SoundType::SHIELD_DOWN, s->pos, 0.45f, 600.0f);
+                    if (g->shield <= 0) events.spatial(SoundType::SHIELD_DOWN, s->pos, 0.45f, 600.0f);
                     if (s->ammoType != AmmoType::PIERCING) { s->active = false; }
-                    vfx.spawnBurst(s->pos, 5, {100, 200, 255, 255}); 
-                    playSpatial(SoundType::HIT, s->pos, 0.25f, 800.0f); 
+                    events.burst(s->pos, 5, {100, 200, 255, 255}); 
+                    events.spatial(SoundType::HIT, s->pos, 0.25f, 800.0f); 
                 }
                 else { 
                     c->stability -= dmg; s->active = false; 
-                    vfx.spawnBurst(s->pos, 8, COL_SLUG); 
-                    playSpatial(SoundType::HIT, s->pos, 0.3f, 400.0f);
+                    events.burst(s->pos, 8, COL_SLUG); 
+                    events.spatial(SoundType::HIT, s->pos, 0.3f, 400.0f);
                     if (c->stability <= 0) { 
                         c->contained = true; c->vel = {0, 0}; 
                         score += (int)(50 * multiplier); multiplier += 0.1f; multiplierTimer = 3.0f; 
                         if (dynamic_cast<FinalBossCore*>(c)) {
-                            audio.play(SoundType::BOSS_DIE, 1.0f, 60.0f);
-                            vfx.spawnBurst(c->pos, 100, COL_GOLD);
-                            vfx.triggerFlash(0.8f);
+                            events.sound(SoundType::BOSS_DIE, 1.0f, 60.0f);
+                            events.burst(c->pos, 100, COL_GOLD);
+                            events.triggerFlash(0.8f);
                             shake = 20.0f;
-                            hud.addLog("CRITICAL: BOSS ANOMALY NEUTRALIZED", COL_GOLD);
+                            events.log("CRITICAL: BOSS ANOMALY NEUTRALIZED", COL_GOLD);
                         }
                     } 
                 }
             }
         } else if (s->bounds.intersects(p->bounds)) { 
             damagePlayer(10.0f);
-            s->active = false; vfx.spawnBurst(s->pos, 5, COL_PLAYER); 
+            s->active = false; events.burst(s->pos, 5, COL_PLAYER); 
             multiplier = 1.0f; multiplierTimer = 0;
         }
     }
-    slugs.erase(std::remove_if(slugs.begin(), slugs.end(), [](KineticSlug* s) { if (!s->active) { delete s; return true; } return false; }), slugs.end());
+    slugs.erase(std::remove_if(slugs.begin(), slugs.end(), [this](KineticSlug* s) { if (!s->active) { arena.destroy(s); return true; } return false; }), slugs.end());
 }
 
 void Game::updateEchoes(float dt) {
-    if (state == GameState::PLAYING && rand() % 1000 < 1 + sector) echoes.push_back(new NeuralEcho(p->pos + Vec2((float)(rand() % 400 - 200), (float)(rand() % 400 - 200))));
+    PROFILE_SCOPE("updateEchoes");
+    if (state == GameState::PLAYING && gameRand() % 1000 < 1 + sector) echoes.push_back(arena.make<NeuralEcho>(p->pos + Vec2((float)(gameRand() % 400 - 200), (float)(gameRand() % 400 - 200))));
     for (auto e : echoes) { 
         e->vel = (p->pos - e->pos).normalized() * 100.0f; e->update(dt, map); 
         if (e->active && e->bounds.intersects(p->bounds)) { 
             damagePlayer(15.0f);
-            e->active = false; vfx.triggerFlash(0.3f); 
+            e->active = false; events.triggerFlash(0.3f); 
         }
-        if (e->active && e->pos.distance(p->pos) < 200.0f && rand() % 100 == 0) {
-            playSpatial(SoundType::ECHO_VOICE, e->pos, 0.2f, 200.0f + (rand() % 400));
+        if (e->active && e->pos.withinRadius(p->pos, 200.0f) && gameRand() % 100 == 0) {
+            events.spatial(SoundType::ECHO_VOICE, e->pos, 0.2f, 200.0f + (gameRand() % 400));
         }
     }
-    echoes.erase(std::remove_if(echoes.begin(), echoes.end(), [](NeuralEcho* e) { if (!e->active) { delete e; return true; } return false; }), echoes.end());
+    echoes.erase(std::remove_if(echoes.begin(), echoes.end(), [this](NeuralEcho* e) { if (!e->active) { arena.destroy(e); return true; } return false; }), echoes.end());
 }
 
-void Game::spawnFText(Vec2 pos, std::string t, SDL_Color c) { 
-    fTexts.push_back({pos, t, 1.0f, c}); 
-    audio.play(SoundType::UI_CLICK, 0.15f, 1500.0f);
+std::vector<uint8_t> Game::saveSnapshot() const {
+    Snapshot::Writer w;
+    w.buf.reserve(16384);
+    w.put(Snapshot::MAGIC); w.put(Snapshot::VERSION);
+    w.put(state); w.put(sector); w.put(score); w.put(multiplier); w.put(multiplierTimer);
+    w.put(alertTimer); w.put(energyAlertTimer); w.put(titleTimer); w.put(pulseTimer); w.put(shake); w.put(cam);
+    w.put(currentAmmo); w.put((uint8_t)debugMode); w.put(objective.currentType); w.put(gameRng().state); w.put(nextSectorSeed);
+    Serialize::writeMap(w, map);
+    Serialize::writePlayer(w, *p);
+    w.put((uint32_t)cores.size());
+    for (auto c : cores) Serialize::writeCore(w, c, cores);
+    w.put((uint32_t)aiSched.requests().size());
+    for (const auto& rq : aiSched.requests()) {
+        w.put((int)(std::find(cores.begin(), cores.end(), rq.core) - cores.begin())); w.put(rq.dist);
+    }
+    w.put((uint32_t)slugs.size());
+    for (auto sl : slugs) Serialize::writeSlug(w, *sl);
+    w.put((uint32_t)echoes.size());
+    for (auto e : echoes) Serialize::writeEcho(w, *e);
+    w.put((uint32_t)items.size());
+    for (auto i : items) Serialize::writeItem(w, *i);
+    w.put((uint32_t)decorations.size());
+    for (auto d : decorations) Serialize::writeDecoration(w, *dynamic_cast<DecorativeMachine*>(d));
+    w.put((uint8_t)(exit != nullptr));
+    if (exit) Serialize::writeEntity(w, *exit);
+    w.put((uint8_t)endurance);
+    if (endurance) {
+        w.put(world.seed()); w.put(worldCx); w.put(worldCy); w.put(dormantTimer);
+        w.put((uint32_t)visitedChunks.size());
+        for (auto k : visitedChunks) w.put(k);
+        w.put((uint32_t)coreChunks.size());
+        for (auto k : coreChunks) w.put(k);
+        w.put((uint32_t)dormantCores.size());
+        for (auto c : dormantCores) Serialize::writeCore(w, c, dormantCores);
+        w.put((uint32_t)dormantItems.size());
+        for (auto i : dormantItems) Serialize::writeItem(w, *i);
+        w.put((uint32_t)dormantDecorations.size());
+        for (auto d : dormantDecorations) Serialize::writeDecoration(w, *dynamic_cast<DecorativeMachine*>(d));
+    }
+    return w.buf;
 }
 
-void Game::render() {
+bool Game::loadSnapshot(const uint8_t* data, size_t size) {
+    Snapshot::Reader r(data, size);
+    if (r.get<uint32_t>() != Snapshot::MAGIC || r.get<uint32_t>() != Snapshot::VERSION) return false;
+    // Everything is parsed into locals and a staging arena first; the session is only replaced once the
+    // whole file has read cleanly, so a truncated or corrupt snapshot leaves it as it was
+    Arena staged;
+    uint64_t rngBefore = gameRng().state; // Constructors below draw from the RNG
+    GameState st = r.getEnum(GameState::SUMMARY);
+    int sec = r.get<int>(), sc = r.get<int>();
+    float mult = r.get<float>(), multT = r.get<float>(), alertT = r.get<float>(), energyT = r.get<float>(), titleT = r.get<float>(), pulseT = r.get<float>(), sh = r.get<float>();
+    Vec2 cm = r.get<Vec2>();
+    AmmoType ammo = r.getEnum(AmmoType::PIERCING);
+    bool dbg = r.get<uint8_t>() != 0;
+    ObjectiveSystem::Type obj = r.getEnum(ObjectiveSystem::ENDURE);
+    uint64_t rngState = r.get<uint64_t>(), nextSeed = r.get<uint64_t>();
+    if (sec < 1) r.ok = false;
+    std::vector<std::vector<Tile>> m;
+    Serialize::readMap(r, m);
+    Player* pl = Serialize::readPlayer(r, staged);
+    uint32_t n = r.getCount(Serialize::ENTITY_BYTES);
+    std::vector<RogueCore*> cs;
+    std::vector<int> targets(n, -1);
+    for (uint32_t i = 0; i < n && r.ok; ++i) cs.push_back(Serialize::readCore(r, staged, targets[i]));
+    Serialize::linkCores(cs, targets);
+    n = r.getCount(sizeof(int) + sizeof(float));
+    std::vector<std::pair<int, float>> replans;
+    for (uint32_t i = 0; i < n && r.ok; ++i) { int idx = r.get<int>(); float dist = r.get<float>(); replans.push_back({idx, dist}); }
+    std::vector<KineticSlug*> sl;
+    n = r.getCount(Serialize::ENTITY_BYTES);
+    for (uint32_t i = 0; i < n && r.ok; ++i) sl.push_back(Serialize::readSlug(r, staged));
+    std::vector<NeuralEcho*> ec;
+    n = r.getCount(Serialize::ENTITY_BYTES);
+    for (uint32_t i = 0; i < n && r.ok; ++i) ec.push_back(Serialize::readEcho(r, staged));
+    std::vector<Item*> its;
+    n = r.getCount(Serialize::ENTITY_BYTES);
+    for (uint32_t i = 0; i < n && r.ok; ++i) its.push_back(Serialize::readItem(r, staged));
+    std::vector<Entity*> decs;
+    n = r.getCount(Serialize::ENTITY_BYTES);
+    for (uint32_t i = 0; i < n && r.ok; ++i) decs.push_back(Serialize::readDecoration(r, staged));
+    Entity* ex = nullptr;
+    if (r.get<uint8_t>()) { ex = staged.make<Entity>(Vec2{0, 0}, 40, 40, EntityType::EXIT); Serialize::readEntity(r, *ex); }
+    bool end = r.get<uint8_t>() != 0;
+    uint64_t worldSeed = 0; int wcx = 0, wcy = 0; float dormantT = 0.0f;
+    std::vector<uint64_t> visited, spentCores;
+    std::vector<RogueCore*> dcs;
+    std::vector<Item*> dits;
+    std::vector<Entity*> ddecs;
+    if (end) {
+        worldSeed = r.get<uint64_t>(); wcx = r.get<int>(); wcy = r.get<int>(); dormantT = r.get<float>();
+        n = r.getCount(sizeof(uint64_t));
+        for (uint32_t i = 0; i < n && r.ok; ++i) visited.push_back(r.get<uint64_t>());
+        std::sort(visited.begin(), visited.end());
+        n = r.getCount(sizeof(uint64_t));
+        for (uint32_t i = 0; i < n && r.ok; ++i) spentCores.push_back(r.get<uint64_t>());
+        std::sort(spentCores.begin(), spentCores.end());
+        n = r.getCount(Serialize::ENTITY_BYTES);
+        targets.assign(n, -1);
+        for (uint32_t i = 0; i < n && r.ok; ++i) dcs.push_back(Serialize::readCore(r, staged, targets[i]));
+        Serialize::linkCores(dcs, targets);
+        n = r.getCount(Serialize::ENTITY_BYTES);
+        for (uint32_t i = 0; i < n && r.ok; ++i) dits.push_back(Serialize::readItem(r, staged));
+        n = r.getCount(Serialize::ENTITY_BYTES);
+        for (uint32_t i = 0; i < n && r.ok; ++i) ddecs.push_back(Serialize::readDecoration(r, staged));
+    }
+    if (!r.ok) { gameRng().state = rngBefore; return false; } // The staging arena frees what was read
+
+    cleanup();
+    arena.swap(staged);
+    state = st; sector = sec; score = sc; multiplier = mult; multiplierTimer = multT;
+    alertTimer = alertT; energyAlertTimer = energyT; titleTimer = titleT; pulseTimer = pulseT; shake = sh; cam = cm;
+    currentAmmo = ammo; debugMode = dbg; objective.currentType = obj; nextSectorSeed = nextSeed;
+    map.swap(m);
+    p = pl; exit = ex;
+    cores.assign(cs.begin(), cs.end()); slugs.assign(sl.begin(), sl.end()); echoes.assign(ec.begin(), ec.end());
+    items.assign(its.begin(), its.end()); decorations.assign(decs.begin(), decs.end());
+    coreStats.recount(cores);
+    for (const auto& rq : replans) {
+        if (rq.first >= 0 && rq.first < (int)cores.size()) { cores[rq.first]->replanQueued = false; aiSched.requestReplan(cores[rq.first], rq.second); }
+    }
+    endurance = end;
+    if (endurance) {
+        // The window itself came with the map above; the chunk cache refills lazily from the seed
+        world.reset(worldSeed); worldCx = wcx; worldCy = wcy; dormantTimer = dormantT;
+        visitedChunks.swap(visited); coreChunks.swap(spentCores);
+        dormantCores.swap(dcs); dormantItems.swap(dits); dormantDecorations.swap(ddecs);
+    }
+    gameRng().state = rngState;
+    if (state == GameState::SUMMARY) submitPlan();
+    storePrevState();
+    return true;
+}
+
+// Serialized here, written and fsynced on the save service's I/O thread
+void Game::saveProgress() {
+    SaveData sd = {sector, score, p->suitIntegrity};
+    Snapshot::Writer w;
+    w.put(sd);
+    saves.submit("recoil_save.bin", SAVE_VERSION, std::move(w.buf));
+}
+
+bool Game::saveSnapshotFile(const std::string& path) const {
+    return Snapshot::writeFile(path, saveSnapshot());
+}
+
+bool Game::loadSnapshotFile(const std::string& path) {
+    Snapshot::MappedFile f(path);
+    return f.valid() && loadSnapshot(f.data(), f.size());
+}
+
+uint64_t Game::stateHash() const {
+    std::vector<uint8_t> snap = saveSnapshot();
+    return Replay::hash(snap.data(), snap.size());
+}
+
+void Game::renderTiles() {
+    PROFILE_SCOPE("tiles");
+    int sx = std::max(0, (int)(cam.x / TILE_SIZE)), sy = std::max(0, (int)(cam.y / TILE_SIZE));
+    int ex = std::min(MAP_WIDTH, (int)((cam.x + SCREEN_WIDTH) / TILE_SIZE) + 1), ey = std::min(MAP_HEIGHT, (int)((cam.y + SCREEN_HEIGHT) / TILE_SIZE) + 1);
+    for (int y = sy; y < ey; ++y) for (int x = sx; x < ex; ++x) {
+        SDL_Rect r = {(int)(x * TILE_SIZE - cam.x), (int)(y * TILE_SIZE - cam.y), TILE_SIZE, TILE_SIZE};
+        if (map[y][x].type == WALL) SDL_SetRenderDrawColor(ren, COL_WALL.r, COL_WALL.g, COL_WALL.b, 255);
+        else if (map[y][x].type == FLOOR) SDL_SetRenderDrawColor(ren, COL_FLOOR.r, COL_FLOOR.g, COL_FLOOR.b, 255);
+        else { // HAZARD_TILE
+            Uint8 flicker = (Uint8)(100 + std::sin(SDL_GetTicks() * 0.02f) * 50);
+            SDL_SetRenderDrawColor(ren, flicker, flicker, 0, 255);
+        }
+        SDL_RenderFillRect(ren, &r);
+        if (map[y][x].type == WALL) { SDL_SetRenderDrawColor(ren, 50, 50, 100, 255); SDL_RenderDrawRect(ren, &r); }
+    }
+}
+
+template <typename T>
+static void cullLayer(SpatialGrid& grid, const std::vector<T*>& all, const Rect& view, std::vector<int>& hits, std::vector<T*>& out) {
+    grid.build((int)all.size(), [&](int i) { return all[i]->bounds.center(); });
+    grid.query(view, hits);
+    out.clear();
+    for (int i : hits) out.push_back(all[i]);
+}
+
+// One visibility pass per frame; every world-space render pass below draws from these lists only.
+void Game::cullVisible() {
+    PROFILE_SCOPE("cull");
+    Rect view = {cam.x - CULL_MARGIN, cam.y - CULL_MARGIN, SCREEN_WIDTH + 2 * CULL_MARGIN, SCREEN_HEIGHT + 2 * CULL_MARGIN};
+    cullLayer(visGrid, cores, view, visHits, visible.cores);
+    cullLayer(visGrid, slugs, view, visHits, visible.slugs);
+    cullLayer(visGrid, items, view, visHits, visible.items);
+    cullLayer(visGrid, echoes, view, visHits, visible.echoes);
+    cullLayer(visGrid, decorations, view, visHits, visible.decorations);
+}
+
+// Snapshot of everything render interpolation reads, taken before each sim step.
+void Game::storePrevState() {
+    prevCam = cam;
+    if (p) p->prevPos = p->pos;
+    for (auto c : cores) c->prevPos = c->pos;
+    for (auto s : slugs) s->prevPos = s->pos;
+    for (auto e : echoes) e->prevPos = e->pos;
+    for (auto i : items) i->prevPos = i->pos;
+}
+
+// Draw at prev + (pos - prev) * alpha. The exact sim state is stashed and put back afterwards
+// so rendering never perturbs the simulation (replays and state hashes depend on that).
+void Game::beginInterpolation(float alpha) {
+    simCam = cam;
+    cam = prevCam + (cam - prevCam) * alpha;
+    lerped.clear(); lerpStash.clear();
+    if (p) lerped.push_back(p);
+    lerped.insert(lerped.end(), cores.begin(), cores.end());
+    lerped.insert(lerped.end(), slugs.begin(), slugs.end());
+    lerped.insert(lerped.end(), echoes.begin(), echoes.end());
+    lerped.insert(lerped.end(), items.begin(), items.end());
+    for (auto e : lerped) {
+        lerpStash.push_back({e->pos, e->bounds.x, e->bounds.y});
+        Vec2 d = (e->prevPos - e->pos) * (1.0f - alpha);
+        e->pos = e->pos + d; e->bounds.x += d.x; e->bounds.y += d.y;
+    }
+}
+
+void Game::endInterpolation() {
+    cam = simCam;
+    for (size_t i = 0; i < lerped.size(); ++i) { lerped[i]->pos = lerpStash[i].pos; lerped[i]->bounds.x = lerpStash[i].bx; lerped[i]->bounds.y = lerpStash[i].by; }
+}
+
+void Game::render(float alpha) {
+    PROFILE_SCOPE("render");
     SDL_SetRenderDrawColor(ren, COL_BG.r, COL_BG.g, COL_BG.b, 255); SDL_RenderClear(ren);
     if (state == GameState::MENU || state == GameState::SUMMARY || state == GameState::GAME_OVER) {
         SDL_SetRenderDrawColor(ren, 15, 20, 25, 255);
@@ -494,37 +942,33 @@ void Game::render() {
         hud.renderMenu(ren, font, fontL);
     }
     else if (state == GameState::PLAYING) {
-        int sx = std::max(0, (int)(cam.x / TILE_SIZE)), sy = std::max(0, (int)(cam.y / TILE_SIZE));
-        int ex = std::min(MAP_WIDTH, (int)((cam.x + SCREEN_WIDTH) / TILE_SIZE) + 1), ey = std::min(MAP_HEIGHT, (int)((cam.y + SCREEN_HEIGHT) / TILE_SIZE) + 1);
-        for (int y = sy; y < ey; ++y) for (int x = sx; x < ex; ++x) {
-            SDL_Rect r = {(int)(x * TILE_SIZE - cam.x), (int)(y * TILE_SIZE - cam.y), TILE_SIZE, TILE_SIZE};
-            if (map[y][x].type == WALL) SDL_SetRenderDrawColor(ren, COL_WALL.r, COL_WALL.g, COL_WALL.b, 255);
-            else if (map[y][x].type == FLOOR) SDL_SetRenderDrawColor(ren, COL_FLOOR.r, COL_FLOOR.g, COL_FLOOR.b, 255);
-            else { // HAZARD_TILE
-                Uint8 flicker = (Uint8)(100 + std::sin(SDL_GetTicks() * 0.02f) * 50);
-                SDL_SetRenderDrawColor(ren, flicker, flicker, 0, 255);
-            }
-            SDL_RenderFillRect(ren, &r);
-            if (map[y][x].type == WALL) { SDL_SetRenderDrawColor(ren, 50, 50, 100, 255); SDL_RenderDrawRect(ren, &r); }
-        }
+        beginInterpolation(alpha);
+        cullVisible();
+        renderTiles();
 
-        // Layer 1: Floor Illumination
-        for (auto c : cores) if (!c->sanitized) lighting.drawPointLight(ren, c->bounds.center() - cam, 80, COL_CORE, 40);
-        lighting.drawPointLight(ren, p->bounds.center() - cam, 100, {100, 255, 200, 255}, 50);
-        for (auto s : slugs) {
-            SDL_Color sc = s->isPlayer ? (s->ammoType == AmmoType::EMP ? COL_EMP : (s->ammoType == AmmoType::PIERCING ? COL_GOLD : COL_PLAYER)) : COL_ROGUE_SLUG;
-            lighting.drawPointLight(ren, s->pos - cam + Vec2(3,3), 30, sc, 60);
+        // Layer 1: Floor Illumination. Lights are gathered once into the lightmap, which the bloom pass reuses.
+        {
+            PROFILE_SCOPE("lighting.lights");
+            for (auto c : visible.cores) if (!c->sanitized) lighting.addLight(c->bounds.center() - cam, 80, COL_CORE, 40);
+            lighting.addLight(p->bounds.center() - cam, 100, {100, 255, 200, 255}, 50);
+            for (auto s : visible.slugs) {
+                SDL_Color sc = s->isPlayer ? (s->ammoType == AmmoType::EMP ? COL_EMP : (s->ammoType == AmmoType::PIERCING ? COL_GOLD : COL_PLAYER)) : COL_ROGUE_SLUG;
+                lighting.addLight(s->pos - cam + Vec2(3,3), 30, sc, 60);
+            }
+            for (auto i : visible.items) lighting.addLight(i->pos - cam + Vec2(10,10), 30, COL_GOLD, 60);
+            if (exit && exit->active) lighting.addLight(exit->bounds.center() - cam, 120, {100, 255, 100, 255}, 80);
+            lighting.buildLightMap(ren);
+            lighting.compositeLightMap(ren, 255);
         }
 
         // Layer 2: Smoothed Shadows
-        lighting.render(ren, cam);
+        { PROFILE_SCOPE("lighting.render"); lighting.render(ren, cam); }
 
         if (exit) {
             SDL_Rect er = {(int)(exit->pos.x - cam.x), (int)(exit->pos.y - cam.y), 40, 40};
             if (exit->active) { 
                 SDL_SetRenderDrawColor(ren, 100, 255, 100, (Uint8)(150 + std::sin(SDL_GetTicks() * 0.01f) * 100)); 
                 SDL_RenderFillRect(ren, &er); 
-                lighting.drawPointLight(ren, exit->bounds.center() - cam, 120, {100, 255, 100, 255}, 80);
                 renderT("EXTRACTION POINT", er.x - 20, er.y - 25, font, {100, 255, 100, 255}); 
             } else { 
                 SDL_SetRenderDrawColor(ren, 40, 40, 80, 100); 
@@ -533,32 +977,29 @@ void Game::render() {
             }
         }
 
-        for (auto c : cores) { c->render(ren, cam); }
-        for (auto d : decorations) { d->render(ren, cam); }
+        for (auto c : visible.cores) { c->render(ren, cam); }
+        for (auto d : visible.decorations) { d->render(ren, cam); }
         p->render(ren, cam); 
-        for (auto s : slugs) { s->render(ren, cam); }
-        for (auto i : items) { i->render(ren, cam); }
-        for (auto e : echoes) { e->render(ren, cam); }
+        for (auto s : visible.slugs) { s->render(ren, cam); }
+        for (auto i : visible.items) { i->render(ren, cam); }
+        for (auto e : visible.echoes) { e->render(ren, cam); }
 
         // Layer 3: Bloom Pass (Auras on top)
-        for (auto c : cores) if (!c->sanitized) lighting.drawPointLight(ren, c->bounds.center() - cam, 40, COL_CORE, 80);
-        lighting.drawPointLight(ren, p->bounds.center() - cam, 50, {150, 255, 255, 255}, 100);
-        for (auto s : slugs) {
-            SDL_Color sc = s->isPlayer ? (s->ammoType == AmmoType::EMP ? COL_EMP : (s->ammoType == AmmoType::PIERCING ? COL_GOLD : COL_PLAYER)) : COL_ROGUE_SLUG;
-            lighting.drawPointLight(ren, s->pos - cam + Vec2(3,3), 15, sc, 120);
-        }
-        for (auto i : items) lighting.drawPointLight(ren, i->pos - cam + Vec2(10,10), 30, COL_GOLD, 60);
+        lighting.compositeLightMap(ren, BLOOM_ALPHA);
 
-        for (const auto& ft : fTexts) { renderT(ft.text, (int)(ft.pos.x - cam.x), (int)(ft.pos.y - cam.y), font, ft.color); }
-        vfx.render(ren, cam); hud.render(ren, p, score, sector, *this, font, fontL);
+        for (int i = 0; i < fTexts.size(); ++i) { const FloatingText& ft = fTexts[i]; renderT(ft.text.c_str(), (int)(ft.pos.x - cam.x), (int)(ft.pos.y - cam.y), font, ft.color); }
+        { PROFILE_SCOPE("vfx.render"); vfx.render(ren, cam); }
+        { PROFILE_SCOPE("hud.render"); hud.render(ren, p, score, sector, *this, font, fontL); }
         if (titleTimer > 0) {
             SDL_SetRenderDrawBlendMode(ren, SDL_BLENDMODE_BLEND);
             SDL_SetRenderDrawColor(ren, 0, 0, 0, (Uint8)(std::min(1.0f, titleTimer) * 200));
             SDL_Rect tr = {0, SCREEN_HEIGHT / 2 - 60, SCREEN_WIDTH, 120};
             SDL_RenderFillRect(ren, &tr);
-            renderT("SECTOR " + std::to_string(sector), SCREEN_WIDTH / 2 - 80, SCREEN_HEIGHT / 2 - 40, fontL, COL_PLAYER);
-            renderT("OBJECTIVE: " + objective.getDesc(), SCREEN_WIDTH / 2 - 150, SCREEN_HEIGHT / 2 + 10, font, COL_TEXT);
+            char title[32]; snprintf(title, sizeof(title), "SECTOR %d", sector);
+            renderT(title, SCREEN_WIDTH / 2 - 80, SCREEN_HEIGHT / 2 - 40, fontL, COL_PLAYER);
+            renderT(objective.getDesc(), SCREEN_WIDTH / 2 - 150, SCREEN_HEIGHT / 2 + 10, font, COL_TEXT);
         }
+        endInterpolation();
     } else if (state == GameState::SUMMARY) {
         hud.renderSummary(ren, score, sector, font, fontL);
     } else { 
@@ -579,19 +1020,78 @@ void Game::render() {
         SDL_SetRenderDrawBlendMode(ren, SDL_BLENDMODE_NONE);
     }
 
+    if (showProfiler) hud.renderProfiler(ren, font, pacer);
+    hud.text.endFrame();
     SDL_RenderPresent(ren);
 }
 
-void Game::renderT(std::string t, int x, int y, TTF_Font* f, SDL_Color c) {
-    if (!f || t.empty()) return; 
-    SDL_Surface* s = TTF_RenderText_Blended(f, t.c_str(), c);
-    if (s) { 
-        SDL_Texture* tx = SDL_CreateTextureFromSurface(ren, s); 
-        SDL_Rect d = {x, y, s->w, s->h}; 
-        SDL_RenderCopy(ren, tx, NULL, &d); 
-        SDL_DestroyTexture(tx); 
-        SDL_FreeSurface(s); 
+void Game::renderT(const char* t, int x, int y, TTF_Font* f, SDL_Color c) {
+    hud.text.draw(ren, f, t, x, y, c);
+}
+
+// One metrics record for the frame just finished; call after Profiler::endFrame()
+void Game::recordMetrics(int ticks, float frameUs) {
+    Profiler& prof = Profiler::get();
+    static const int zUpdate = prof.zone("update"), zAI = prof.zone("updateAI"), zSim = prof.zone("simulate"), zSlugs = prof.zone("updateSlugs"),
+                     zStream = prof.zone("stream"), zRender = prof.zone("render"), zLightU = prof.zone("lighting.update"),
+                     zLightL = prof.zone("lighting.lights"), zLightR = prof.zone("lighting.render"), zHud = prof.zone("hud.render");
+    FrameMetrics m;
+    m.frame = metricsSeen.frames++;
+    m.us[FrameMetrics::FRAME] = frameUs;
+    m.us[FrameMetrics::UPDATE] = prof.frameUs(zUpdate, 0);
+    m.us[FrameMetrics::AI] = prof.frameUs(zAI, 0);
+    m.us[FrameMetrics::SIMULATE] = prof.frameUs(zSim, 0);
+    m.us[FrameMetrics::SLUGS] = prof.frameUs(zSlugs, 0);
+    m.us[FrameMetrics::STREAM] = prof.frameUs(zStream, 0);
+    m.us[FrameMetrics::RENDER] = prof.frameUs(zRender, 0);
+    m.us[FrameMetrics::LIGHTING] = prof.frameUs(zLightU, 0) + prof.frameUs(zLightL, 0) + prof.frameUs(zLightR, 0);
+    m.us[FrameMetrics::HUD] = prof.frameUs(zHud, 0);
+    uint32_t* n = m.count;
+    n[FrameMetrics::TICKS] = ticks;
+    for (auto c : cores) {
+        if (dynamic_cast<RepairDrone*>(c)) n[FrameMetrics::DRONES]++;
+        else if (dynamic_cast<SeekerSwarm*>(c)) n[FrameMetrics::SWARMS]++;
+        else if (dynamic_cast<FinalBossCore*>(c)) n[FrameMetrics::BOSSES]++;
+        else n[FrameMetrics::CORES]++;
     }
+    n[FrameMetrics::ECHOES] = echoes.size();
+    n[FrameMetrics::ITEMS] = items.size();
+    n[FrameMetrics::SLUGS_LIVE] = slugs.size();
+    n[FrameMetrics::PARTICLES] = vfx.particles.size();
+    n[FrameMetrics::PATHS] = aiSched.replansTotal - metricsSeen.paths;
+    n[FrameMetrics::SOUNDS] = audio.played - metricsSeen.sounds;
+    if (state == GameState::PLAYING) n[FrameMetrics::SPRITES] = visible.cores.size() + visible.slugs.size() + visible.items.size() + visible.echoes.size() + visible.decorations.size();
+    n[FrameMetrics::TEXT_DRAWS] = hud.text.draws - metricsSeen.textDraws;
+    n[FrameMetrics::TEXT_RASTERS] = hud.text.misses - metricsSeen.textRasters;
+    metricsSeen.paths = aiSched.replansTotal; metricsSeen.sounds = audio.played;
+    metricsSeen.textDraws = hud.text.draws; metricsSeen.textRasters = hud.text.misses;
+    metrics.push(m);
 }
 
-void Game::loop() { while (running) { Uint32 st = SDL_GetTicks(); handleInput(); update(); render(); Uint32 t = SDL_GetTicks() - st; if (t < FRAME_DELAY) SDL_Delay((Uint32)FRAME_DELAY - t); } }
\ No newline at end of file
+void Game::loop() {
+    int frameZone = Profiler::get().zone("frame");
+    pacer.reset();
+    while (running) {
+        uint64_t frameStart = Profiler::nowNs();
+        int ticks = 0;
+        pacer.beginFrame();
+        input.pump(pacer.frameTime());
+        while (running && pacer.step()) {
+            ticks++;
+            input.beginTick(pacer.tickStart, pacer.tickEnd);
+            handleInput();
+            if (!running) break;
+            recorder.record(input, (recorder.tickCount() % Replay::HASH_INTERVAL == 0) ? stateHash() : 0);
+            update();
+            input.endTick();
+        }
+        if (!running) break;
+        render(pacer.alpha());
+        uint64_t frameEnd = Profiler::nowNs();
+        Profiler::get().record(frameZone, frameStart, frameEnd);
+        Profiler::get().endFrame();
+        if (metrics.isOpen()) recordMetrics(ticks, (frameEnd - frameStart) / 1000.0f);
+        pacer.limit();
+    }
+    pacer.report(stdout);
+}
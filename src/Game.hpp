@@ -12,45 +12,106 @@
 #include "engine/LightingManager.hpp"
 #include "engine/VFXManager.hpp"
 #include "engine/AudioManager.hpp"
+#include "engine/LineOfSight.hpp"
+#include "engine/JobSystem.hpp"
+#include "engine/SimEvents.hpp"
+#include "engine/Replay.hpp"
+#include "engine/FramePacer.hpp"
+#include "engine/Arena.hpp"
+#include "engine/SpatialGrid.hpp"
+#include "engine/Proximity.hpp"
+#include "engine/World.hpp"
+#include "engine/SaveService.hpp"
+#include "engine/Metrics.hpp"
 #include "ui/HUD.hpp"
 #include "gameplay/Actor.hpp"
 #include "gameplay/Slug.hpp"
 #include "gameplay/Item.hpp"
+#include "gameplay/AIScheduler.hpp"
+#include "gameplay/CoreStats.hpp"
+#include "gameplay/SectorPlan.hpp"
 
 class ObjectiveSystem {
 public:
-    enum Type { CLEAR_CORES, REACH_EXIT };
+    enum Type { CLEAR_CORES, REACH_EXIT, ENDURE };
     Type currentType = CLEAR_CORES;
     void update(Game& game);
-    std::string getDesc() const;
+    const char* getDesc() const;
 };
 
 class Game {
 public:
     bool running = true;
+    bool headless = false;
+    bool replaying = false;
     GameState state = GameState::MENU;
     SDL_Window* win = nullptr;
     SDL_Renderer* ren = nullptr;
     TTF_Font *font = nullptr, *fontL = nullptr;
 
+    Arena arena; // Owns every sector object below; reset on sector change
     std::vector<std::vector<Tile>> map;
     InputHandler input;
     LightingManager lighting;
     VFXManager vfx;
     AudioManager audio;
+    LineOfSight los;
+    AIScheduler aiSched;
+    JobSystem jobs;
+    SaveService saves;
+    MetricsLog metrics; // Off until opened (--metrics)
     ObjectiveSystem objective;
     HUD hud;
+    Replay::Recorder recorder;
+    FramePacer pacer;
 
     Player* p = nullptr;
     std::vector<RogueCore*> cores;
+    CoreStats coreStats; // Aggregates over cores; update it wherever cores or their flags change
     std::vector<KineticSlug*> slugs;
     std::vector<NeuralEcho*> echoes;
     std::vector<Item*> items;
     std::vector<Entity*> decorations;
-    std::vector<FloatingText> fTexts;
+    FixedRing<FloatingText, 64> fTexts;
+    std::vector<RogueCore*> movers;
+    ProximitySet coreProx; // Core centres, measured from the player once per tick
+    std::vector<RogueCore*> pendingSpawns;
+    std::vector<EventBus> chunkEvents;
+    EventBus events{512, 64}; // This tick's side effects, applied by drainEvents()
+    struct LerpStash { Vec2 pos; float bx, by; };
+    std::vector<Entity*> lerped;
+    std::vector<LerpStash> lerpStash;
+    Vec2 simCam = {0, 0};
+    // Render-only: what the camera can see this frame, rebuilt by cullVisible() after interpolation
+    struct VisibleSet {
+        std::vector<RogueCore*> cores;
+        std::vector<KineticSlug*> slugs;
+        std::vector<Item*> items;
+        std::vector<NeuralEcho*> echoes;
+        std::vector<Entity*> decorations;
+    } visible;
+    SpatialGrid visGrid{CULL_CELL, (MAP_WIDTH * TILE_SIZE + CULL_CELL - 1) / CULL_CELL, (MAP_HEIGHT * TILE_SIZE + CULL_CELL - 1) / CULL_CELL};
+    std::vector<int> visHits;
     Entity* exit = nullptr;
 
+    // Endurance mode: map is a window onto an unbounded seeded world, slid along by streamWorld()
+    bool endurance = false;
+    ChunkedWorld world;
+    int worldCx = 0, worldCy = 0; // World chunk at the window's top-left
+    std::vector<uint64_t> visitedChunks; // Sorted keys of chunks that have had their spawn roll
+    std::vector<uint64_t> coreChunks; // Sorted keys of chunks whose core has spawned; never pruned, so revisits cannot farm score
+    std::vector<RogueCore*> dormantCores; // Outside the window: coarse simulation only
+    std::vector<Item*> dormantItems;
+    std::vector<Entity*> dormantDecorations;
+    float dormantTimer = 0.0f;
+
+    // Next sector, planned on a worker while the summary screen is up (see planNextSector)
+    SectorPlan nextPlan;
+    JobCounter planJob;
+    uint64_t nextSectorSeed = 0;
+
     Vec2 cam = {0, 0};
+    Vec2 prevCam = {0, 0};
     float shake = 0.0f;
     int score = 0;
     int sector = 1;
@@ -61,27 +122,53 @@ public:
     float titleTimer = 0.0f;
     float pulseTimer = 0.0f;
     bool debugMode = false;
+    bool showProfiler = false;
+    int steadyTicks = 0; // PLAYING ticks since the sector was built or restored
+    struct MetricsSeen { uint64_t paths = 0; uint32_t sounds = 0; int textDraws = 0, textRasters = 0, frames = 0; } metricsSeen; // Totals at the last record
     AmmoType currentAmmo = AmmoType::STANDARD;
 
-    Game();
+    // workers: JobSystem threads, -1 for one per spare core; bulk runners use 0 and parallelize across games.
+    // start: build the opening sector now; pass false to set sector or mode first and call init() once
+    explicit Game(bool headless = false, bool vsync = true, int workers = -1, bool start = true);
     ~Game();
     void init();
     void cleanup();
-    void generateLevel();
-    Vec2 findSpace(float w = 24, float h = 24);
+    void startSector(SectorPlan& plan);
+    void saveProgress();
+    void planNextSector();
+    void submitPlan();
     void handleInput();
     void update();
-    void render();
-    void renderT(std::string t, int x, int y, TTF_Font* f, SDL_Color c);
+    void render(float alpha = 1.0f);
+    void storePrevState();
+    void beginInterpolation(float alpha);
+    void endInterpolation();
+    void renderTiles();
+    void cullVisible();
+    void renderT(const char* t, int x, int y, TTF_Font* f, SDL_Color c);
 
     void updateAI(float dt);
-    void updateSlugs(float dt);
+    void simulate(float dt, float wdt);
+    void flushEvents();
+    void drainEvents();
+    void resolveAI();
+    void updateSlugs();
     void updateEchoes(float dt);
     void updatePickups();
     void updateWeapons(float dt);
+    void streamWorld();
+    void updateDormant(float dt);
+    void wakeDormant();
+    void spawnInChunk(int wx, int wy);
+    bool placeOnFloor(Entity* e);
     void damagePlayer(float amount);
-    void spawnFText(Vec2 pos, std::string t, SDL_Color c);
-    void playSpatial(SoundType type, Vec2 pos, float vol = 0.2f, float freq = 440.0f);
+    bool spatialize(Vec2 pos, float& vol, float& pan);
+    std::vector<uint8_t> saveSnapshot() const;
+    bool loadSnapshot(const uint8_t* data, size_t size);
+    bool saveSnapshotFile(const std::string& path) const;
+    bool loadSnapshotFile(const std::string& path);
+    uint64_t stateHash() const;
+    void recordMetrics(int ticks, float frameUs);
     void loop();
 };
 
@@ -8,13 +8,27 @@ const int SCREEN_HEIGHT = 600;
 const int TILE_SIZE = 40;
 const int MAP_WIDTH = 50;
 const int MAP_HEIGHT = 50;
+const int PATH_RESERVE = 2 * (MAP_WIDTH + MAP_HEIGHT); // Path capacity per core, so replanning doesn't reallocate
 const int TARGET_FPS = 60;
 const float FRAME_DELAY = 1000.0f / TARGET_FPS;
+const float SIM_DT = 1.0f / TARGET_FPS; // Fixed simulation step, independent of display rate
+const int CULL_CELL = 160; // Spatial grid cell for render culling, in pixels
+const float CULL_MARGIN = 128.0f; // Beyond the screen edge; covers the largest light radius
+const int ALLOC_WARMUP_TICKS = 120; // Ticks after a sector load before RECOIL_ASSERT_NO_ALLOCS arms
+const int MAX_SIM_STEPS = 5; // Per rendered frame; beyond this the world slows down instead of spiralling
 
 const float PLAYER_SPEED = 220.0f;
 const float DASH_SPEED = 850.0f;
 const float AI_SPEED = 140.0f;
 const float REFLEX_SCALE = 0.25f;
+const float DORMANT_STEP = 1.0f; // Coarse simulation interval for entities outside the streamed window
+const float DORMANT_SPEED = 0.25f; // Fraction of AI_SPEED dormant cores close in at
+const int DORMANT_CHUNKS = 3; // Dormant entities and explored-chunk keys are kept this far beyond the window
+const float AI_BUDGET_US = 500.0f; // Per-frame pathfinding budget
+const float AI_PATH_BASE_US = 12.0f; // Cost model for one A* search, calibrated at -O2
+const float AI_PATH_NODE_US = 0.15f;
+const float SOUND_STACK_BOOST = 0.15f; // Volume added per repeat when same-type sounds in a tick merge
+const int SOUND_STACK_MAX = 5; // Repeats that still add volume
 
 const SDL_Color COL_BG = {5, 5, 10, 255};
 const SDL_Color COL_WALL = {35, 40, 55, 255};
@@ -28,5 +42,6 @@ const SDL_Color COL_TEXT = {220, 230, 255, 255};
 const SDL_Color COL_GOLD = {255, 215, 0, 255};
 const SDL_Color COL_EMP = {100, 150, 255, 255};
 const SDL_Color COL_CONTAINED = {100, 200, 255, 255};
+const Uint8 BLOOM_ALPHA = 140; // Share of the lightmap added again over entities as bloom
 
 #endif
\ No newline at end of file
@@ -2,6 +2,8 @@
 #define ENUMS_HPP
 
 #include "Rect.hpp"
+#include "Random.hpp"
+#include "SmallString.hpp"
 #include <SDL2/SDL.h>
 #include <string>
 #include <cstdio>
@@ -11,6 +13,8 @@ enum class EntityType { PLAYER, ROGUE_CORE, NEURAL_ECHO, KINETIC_SLUG, ITEM, EXI
 enum class AmmoType { STANDARD, EMP, PIERCING };
 enum class ItemType { REPAIR_KIT, BATTERY_PACK, COOLANT, OVERCLOCK };
 enum TileType { WALL, FLOOR, HAZARD_TILE };
+enum class Action : uint8_t { MOVE_UP, MOVE_DOWN, MOVE_LEFT, MOVE_RIGHT, FIRE, DASH, RELOAD, REFLEX, PULSE, AMMO_STANDARD, AMMO_EMP, AMMO_PIERCING,
+                              CONFIRM, DEV_MODE, DEV_SKIP, SNAPSHOT_SAVE, SNAPSHOT_LOAD, PROFILER, TRACE_EXPORT, COUNT };
 
 struct Tile {
     TileType type;
@@ -20,18 +24,14 @@ struct Tile {
 struct SaveData {
     int sector; int score; float integrity;
 };
-
-inline void saveProgress(const SaveData& data) {
-    FILE* f = fopen("recoil_save.bin", "wb");
-    if (f) { fwrite(&data, sizeof(SaveData), 1, f); fclose(f); }
-}
+const uint32_t SAVE_VERSION = 2; // Schema of SaveData in recoil_save.bin; 1 was the raw struct without a header
 
 struct Particle {
     Vec2 pos; Vec2 vel; float life; float maxLife; SDL_Color color; float size;
 };
 
 struct FloatingText {
-    Vec2 pos; std::string text; float life; SDL_Color color;
+    Vec2 pos; SmallString<32> text; float life; SDL_Color color;
 };
 
 #endif
@@ -0,0 +1,50 @@
+#ifndef FASTMATH_HPP
+#define FASTMATH_HPP
+
+#include <cstdint>
+#include <cstring>
+
+// Polynomial stand-ins for libm in hot loops, branch-light and inlinable. Only functions that beat
+// libm in ./bench math belong here (exp and 1/sqrt did not). Bounds below are the worst case measured
+// over the stated domain; results are deterministic for a given build but not bit-identical to std::.
+namespace FastMath {
+    constexpr float PI = 3.14159265f, HALF_PI = 1.57079633f;
+
+    // Round to nearest for |x| < 2^22 without a branch or a libm call
+    inline float roundNearest(float x) { return (x + 12582912.0f) - 12582912.0f; }
+
+    // Odd minimax polynomial on [-pi/2, pi/2], negated when k is odd
+    inline float sinPoly(float x, float k) {
+        float x2 = x * x;
+        float r = x * (0.99999660f + x2 * (-0.16664824f + x2 * (0.00830629f + x2 * -0.00018363f)));
+        uint32_t bits, flip = (uint32_t)((int32_t)k & 1) << 31;
+        std::memcpy(&bits, &r, sizeof(bits));
+        bits ^= flip;
+        std::memcpy(&r, &bits, sizeof(r));
+        return r;
+    }
+    // Both reduce by the nearest multiple of pi with a two-part constant. |error| < 2e-6 for |x| < 3e4
+    inline float sin(float x) {
+        float k = roundNearest(x * (1.0f / PI));
+        return sinPoly((x - k * 3.140625f) - k * 9.67653589793e-4f, k);
+    }
+    inline float cos(float x) {
+        float k = roundNearest(x * (1.0f / PI) + 0.5f);
+        return sinPoly(((x - k * 3.140625f) - k * 9.67653589793e-4f) + HALF_PI, k);
+    }
+
+    // Octant-reduced odd polynomial, |error| < 2e-6 rad; atan2(0, 0) is 0
+    inline float atan2(float y, float x) {
+        float ax = x < 0 ? -x : x, ay = y < 0 ? -y : y;
+        float mx = ax > ay ? ax : ay, mn = ax > ay ? ay : ax;
+        if (mx == 0.0f) return 0.0f;
+        float z = mn / mx, z2 = z * z;
+        float r = z * (0.99997726f + z2 * (-0.33262347f + z2 * (0.19354346f + z2 * (-0.11643287f + z2 * (0.05265332f + z2 * -0.01172120f)))));
+        if (ay > ax) r = HALF_PI - r;
+        if (x < 0) r = PI - r;
+        return y < 0 ? -r : r;
+    }
+
+}
+
+#endif
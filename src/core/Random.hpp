@@ -0,0 +1,26 @@
+#ifndef RANDOM_HPP
+#define RANDOM_HPP
+
+#include <cstdint>
+
+// Seedable xorshift64* stream for simulation randomness. Its whole state is one word, so it can
+// be saved, restored and replayed; rand() stays in use only for audio and cosmetic effects.
+class Rng {
+public:
+    uint64_t state;
+    explicit Rng(uint64_t seed = 1) { reseed(seed); }
+    void reseed(uint64_t seed) { state = seed ? seed : 0x9E3779B97F4A7C15ull; }
+    // Non-negative 31-bit value, a drop-in for rand()
+    int next() {
+        state ^= state >> 12; state ^= state << 25; state ^= state >> 27;
+        return (int)((state * 0x2545F4914F6CDD1Dull) >> 33);
+    }
+};
+
+inline Rng& gameRng() { thread_local Rng rng; return rng; }
+inline int gameRand() { return gameRng().next(); }
+// Two draws combined into a 64-bit seed. Separate statements fix which draw is the high word; inside
+// one expression the order of the two calls is up to the compiler.
+inline uint64_t gameRand64() { uint64_t hi = gameRand(); uint64_t lo = gameRand(); return (hi << 32) ^ lo; }
+
+#endif
@@ -0,0 +1,42 @@
+#ifndef SMALLSTRING_HPP
+#define SMALLSTRING_HPP
+
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+
+// Fixed-capacity inline string for UI text. Never allocates; long input is truncated.
+template <int N>
+struct SmallString {
+    char data[N] = {0};
+
+    SmallString() {}
+    SmallString(const char* s) { assign(s); }
+    void assign(const char* s) { strncpy(data, s, N - 1); data[N - 1] = 0; }
+    void format(const char* fmt, ...) {
+        va_list args; va_start(args, fmt); vsnprintf(data, N, fmt, args); va_end(args);
+    }
+    const char* c_str() const { return data; }
+    bool empty() const { return data[0] == 0; }
+    bool operator==(const char* s) const { return strcmp(data, s) == 0; }
+};
+
+// Ring of the most recent N entries; pushing onto a full ring drops the oldest.
+template <typename T, int N>
+class FixedRing {
+public:
+    void push(const T& v) { items[(head + count) % N] = v; if (count < N) count++; else head = (head + 1) % N; }
+    void popFront() { if (count) { head = (head + 1) % N; count--; } }
+    void clear() { head = count = 0; }
+    int size() const { return count; }
+    bool empty() const { return count == 0; }
+    T& front() { return items[head]; }
+    T& operator[](int i) { return items[(head + i) % N]; }
+    const T& operator[](int i) const { return items[(head + i) % N]; }
+
+private:
+    T items[N];
+    int head = 0, count = 0;
+};
+
+#endif
@@ -18,6 +18,10 @@ struct Vec2 {
         return (l > 0.0001f) ? Vec2(x / l, y / l) : Vec2(0, 0);
     }
     float distance(const Vec2& v) const { return (*this - v).length(); }
+    // For threshold tests: no sqrt
+    float lengthSq() const { return x * x + y * y; }
+    float distanceSq(const Vec2& v) const { return (*this - v).lengthSq(); }
+    bool withinRadius(const Vec2& v, float r) const { return distanceSq(v) < r * r; }
 };
 
 #endif
@@ -0,0 +1,45 @@
+#include "Arena.hpp"
+#include <algorithm>
+#include <iterator>
+
+Arena::Header* Arena::allocate(size_t size) {
+    size_t slot = (sizeof(Header) + size + ALIGN - 1) & ~(ALIGN - 1);
+    uint32_t sc = (uint32_t)(slot / ALIGN);
+    Header* h;
+    if (sc < SIZE_CLASSES && freeLists[sc]) {
+        h = (Header*)freeLists[sc];
+        freeLists[sc] = freeLists[sc]->next;
+    } else {
+        if (blockIndex < blocks.size() && offset + slot > blockSize) { blockIndex++; offset = 0; }
+        if (blockIndex == blocks.size()) blocks.push_back((char*)::operator new(blockSize));
+        h = (Header*)(blocks[blockIndex] + offset);
+        offset += slot;
+    }
+    h->dtor = nullptr; h->prev = h->next = nullptr; h->sizeClass = sc;
+    live++;
+    return h;
+}
+
+void Arena::unlink(Header* h) {
+    if (h->prev) h->prev->next = h->next; else finalizers = h->next;
+    if (h->next) h->next->prev = h->prev;
+}
+
+void Arena::destroy(void* obj) {
+    if (!obj) return;
+    Header* h = (Header*)obj - 1;
+    if (h->dtor) { h->dtor(obj); unlink(h); }
+    live--;
+    if (h->sizeClass < SIZE_CLASSES) {
+        FreeSlot* f = (FreeSlot*)h;
+        f->next = freeLists[h->sizeClass];
+        freeLists[h->sizeClass] = f;
+    }
+}
+
+void Arena::reset() {
+    for (Header* h = finalizers; h; h = h->next) h->dtor(h + 1);
+    finalizers = nullptr;
+    std::fill(std::begin(freeLists), std::end(freeLists), nullptr);
+    blockIndex = 0; offset = 0; live = 0;
+}
@@ -0,0 +1,71 @@
+#ifndef ARENA_HPP
+#define ARENA_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Sector-lifetime allocator. Objects come from large blocks via a bump pointer; destroy()
+// returns a slot to a per-size free list for the next spawn of that size, and reset() drops
+// everything at once, keeping the blocks for the next sector. Objects must fit in one block.
+// Owned by the main thread; job threads never spawn or free entities.
+class Arena {
+public:
+    explicit Arena(size_t blockSize = 256 * 1024) : blockSize(blockSize) {}
+    ~Arena() { reset(); for (auto b : blocks) ::operator delete(b); }
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    template <typename T, typename... Args>
+    T* make(Args&&... args) {
+        static_assert(alignof(T) <= ALIGN, "Arena: over-aligned type");
+        Header* h = allocate(sizeof(T));
+        T* obj = new (h + 1) T(std::forward<Args>(args)...);
+        if (!std::is_trivially_destructible<T>::value) {
+            h->dtor = [](void* p) { static_cast<T*>(p)->~T(); };
+            link(h);
+        }
+        return obj;
+    }
+
+    // `obj` must be the address make() returned (single inheritance keeps base pointers equal).
+    void destroy(void* obj);
+    // Runs outstanding destructors and rewinds to the first block. Memory is not returned to the OS.
+    void reset();
+
+    // Exchanges everything, objects included: what one arena made, the other now owns
+    void swap(Arena& o) {
+        std::swap(blockSize, o.blockSize); blocks.swap(o.blocks); std::swap(blockIndex, o.blockIndex); std::swap(offset, o.offset);
+        std::swap(finalizers, o.finalizers); std::swap(freeLists, o.freeLists); std::swap(live, o.live);
+    }
+
+    size_t liveObjects() const { return live; }
+    size_t bytesReserved() const { return blocks.size() * blockSize; }
+
+private:
+    static const size_t ALIGN = 16;
+    static const int SIZE_CLASSES = 64; // Recycled up to 1 KB; larger slots wait for reset()
+
+    struct alignas(ALIGN) Header {
+        void (*dtor)(void*);
+        Header *prev, *next;
+        uint32_t sizeClass;
+    };
+    struct FreeSlot { FreeSlot* next; };
+
+    size_t blockSize;
+    std::vector<char*> blocks;
+    size_t blockIndex = 0, offset = 0;
+    Header* finalizers = nullptr;
+    FreeSlot* freeLists[SIZE_CLASSES] = {};
+    size_t live = 0;
+
+    Header* allocate(size_t size);
+    void link(Header* h) { h->prev = nullptr; h->next = finalizers; if (finalizers) finalizers->prev = h; finalizers = h; }
+    void unlink(Header* h);
+};
+
+#endif
@@ -1,16 +1,55 @@
 #include "AudioManager.hpp"
+#include "../core/FastMath.hpp"
 #include <algorithm>
+#include <array>
 #include <iostream>
+#include <utility>
 #include <cmath>
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
 #endif
 
+static float durationOf(SoundType t) {
+    if (t == SoundType::SHOOT) return 0.3f;
+    else if (t == SoundType::STEP) return 0.12f;
+    else if (t == SoundType::DASH) return 0.4f;
+    else if (t == SoundType::RELOAD) return 0.25f;
+    else if (t == SoundType::HIT) return 0.35f;
+    else if (t == SoundType::PICKUP) return 0.4f;
+    else if (t == SoundType::SANITIZE) return 0.8f;
+    else if (t == SoundType::ALERT) return 0.15f;
+    else if (t == SoundType::RICOCHET) return 0.1f;
+    else if (t == SoundType::EMPTY) return 0.08f;
+    else if (t == SoundType::BOSS_PHASE) return 1.2f;
+    else if (t == SoundType::UI_CLICK) return 0.05f;
+    else if (t == SoundType::UI_CONFIRM) return 0.3f;
+    else if (t == SoundType::EMP_SHOT) return 0.4f;
+    else if (t == SoundType::PIERCE_SHOT) return 0.5f;
+    else if (t == SoundType::SHIELD_DOWN) return 0.6f;
+    else if (t == SoundType::LOW_ENERGY) return 0.2f;
+    else if (t == SoundType::DRIP) return 0.15f;
+    else if (t == SoundType::MACHINERY) return 1.0f;
+    else if (t == SoundType::STEAM) return 0.5f;
+    else if (t == SoundType::ECHO_VOICE) return 0.8f;
+    else if (t == SoundType::ZAP) return 0.12f;
+    else if (t == SoundType::SHIELD_CHARGE) return 0.4f;
+    else if (t == SoundType::READY) return 0.25f;
+    else if (t == SoundType::BOSS_DIE) return 1.5f;
+    else return 0.2f;
+}
+
 AudioManager::AudioManager() {
+    for (int i = 0; i < 32; ++i) sounds[i].active = false;
+    std::fill(delayBuffer, delayBuffer + 8820, 0.0f);
+}
+
+void AudioManager::init() {
+    if (device) return;
+    buildSampleBank(); // Before the device opens: the callback reads the bank without locking
     SDL_AudioSpec want, have;
     SDL_zero(want);
-    want.freq = 44100;
+    want.freq = SAMPLE_RATE;
     want.format = AUDIO_F32;
     want.channels = 2;
     want.samples = 1024;
@@ -23,8 +62,6 @@ AudioManager::AudioManager() {
     } else {
         SDL_PauseAudioDevice(device, 0);
     }
-    for (int i = 0; i < 32; ++i) sounds[i].active = false;
-    std::fill(delayBuffer, delayBuffer + 8820, 0.0f);
 }
 
 AudioManager::~AudioManager() {
@@ -32,6 +69,7 @@ AudioManager::~AudioManager() {
 }
 
 void AudioManager::play(SoundType type, float vol, float freq, float pan) {
+    played++;
     std::lock_guard<std::mutex> lock(audioMutex);
     for (int i = 0; i < 32; ++i) {
         if (!sounds[i].active) {
@@ -43,32 +81,8 @@ void AudioManager::play(SoundType type, float vol, float freq, float pan) {
             sounds[i].phase2 = 0;
             sounds[i].elapsed = 0;
             sounds[i].active = true;
-            if (type == SoundType::SHOOT) sounds[i].duration = 0.3f;
-            else if (type == SoundType::STEP) sounds[i].duration = 0.12f;
-            else if (type == SoundType::DASH) sounds[i].duration = 0.4f;
-            else if (type == SoundType::RELOAD) sounds[i].duration = 0.25f;
-            else if (type == SoundType::HIT) sounds[i].duration = 0.35f;
-            else if (type == SoundType::PICKUP) sounds[i].duration = 0.4f;
-            else if (type == SoundType::SANITIZE) sounds[i].duration = 0.8f;
-            else if (type == SoundType::ALERT) sounds[i].duration = 0.15f;
-            else if (type == SoundType::RICOCHET) sounds[i].duration = 0.1f;
-            else if (type == SoundType::EMPTY) sounds[i].duration = 0.08f;
-            else if (type == SoundType::BOSS_PHASE) sounds[i].duration = 1.2f;
-            else if (type == SoundType::UI_CLICK) sounds[i].duration = 0.05f;
-            else if (type == SoundType::UI_CONFIRM) sounds[i].duration = 0.3f;
-            else if (type == SoundType::EMP_SHOT) sounds[i].duration = 0.4f;
-            else if (type == SoundType::PIERCE_SHOT) sounds[i].duration = 0.5f;
-            else if (type == SoundType::SHIELD_DOWN) sounds[i].duration = 0.6f;
-            else if (type == SoundType::LOW_ENERGY) sounds[i].duration = 0.2f;
-            else if (type == SoundType::DRIP) sounds[i].duration = 0.15f;
-            else if (type == SoundType::MACHINERY) sounds[i].duration = 1.0f;
-            else if (type == SoundType::STEAM) sounds[i].duration = 0.5f;
-            else if (type == SoundType::ECHO_VOICE) sounds[i].duration = 0.8f;
-            else if (type == SoundType::ZAP) sounds[i].duration = 0.12f;
-            else if (type == SoundType::SHIELD_CHARGE) sounds[i].duration = 0.4f;
-            else if (type == SoundType::READY) sounds[i].duration = 0.25f;
-            else if (type == SoundType::BOSS_DIE) sounds[i].duration = 1.5f;
-            else sounds[i].duration = 0.2f;
+            sounds[i].duration = durationOf(type);
+            bankLookup(type, freq, sounds[i]);
             break;
         }
     }
@@ -91,168 +105,287 @@ void AudioManager::setAmbientState(AmbientState state) {
 
 void AudioManager::fillBuffer(float* buffer, int samples) {
     std::lock_guard<std::mutex> lock(audioMutex);
-    float dt = 1.0f / 44100.0f;
+    float dt = 1.0f / SAMPLE_RATE;
     int frames = samples / 2;
 
-    for (int f = 0; f < frames; ++f) {
-        // Smooth ambient freq transition
-        ambientFreq += (targetAmbientFreq - ambientFreq) * 0.0001f;
-        
-        float mono = 0.0f;
-        // Layered Ambient: 3 Sines + 1 slow modulator
-        float l1 = std::sin(ambientPhase);
-        float l2 = std::sin(ambientPhase * 0.501f) * 0.8f;
-        float l3 = std::sin(ambientPhase * 2.002f) * 0.3f;
-        float mod = 0.5f + 0.5f * std::sin(ambientPhase2);
-        
-        // Add a "wind" whirring layer using modulated noise
-        float noise = ((float)rand() / RAND_MAX * 2.0f - 1.0f);
-        float wind = noise * (0.2f + 0.3f * std::sin(ambientPhase2 * 0.5f));
-        
-        float amb = (l1 + l2 + l3) * mod + wind * 0.2f;
-
-        mono += amb * ambientVolume;
-        ambientPhase += 2.0f * M_PI * ambientFreq * dt;
-        ambientPhase2 += 2.0f * M_PI * 0.15f * dt; // Slow 0.15Hz modulation
-        
-        if (ambientPhase > 2.0f * M_PI * 100.0f) ambientPhase -= 2.0f * M_PI * 100.0f;
-        if (ambientPhase2 > 2.0f * M_PI * 100.0f) ambientPhase2 -= 2.0f * M_PI * 100.0f;
-
-        float left = 0, right = 0;
+    for (int b = 0; b < frames; b += MIX_BLOCK) {
+        int n = std::min(MIX_BLOCK, frames - b);
+        float left[MIX_BLOCK] = {}, right[MIX_BLOCK] = {};
+        if (useVoiceKernels) mixGrouped(left, right, n, dt);
+        else mixDynamic(left, right, n, dt);
+
+        for (int f = 0; f < n; ++f) {
+            // Smooth ambient freq transition
+            ambientFreq += (targetAmbientFreq - ambientFreq) * 0.0001f;
+
+            float mono = 0.0f;
+            // Layered Ambient: 3 Sines + 1 slow modulator
+            float l1 = FastMath::sin(ambientPhase);
+            float l2 = FastMath::sin(ambientPhase * 0.501f) * 0.8f;
+            float l3 = FastMath::sin(ambientPhase * 2.002f) * 0.3f;
+            float mod = 0.5f + 0.5f * FastMath::sin(ambientPhase2);
+
+            // Add a "wind" whirring layer using modulated noise
+            float noise = ((float)rand() / RAND_MAX * 2.0f - 1.0f);
+            float wind = noise * (0.2f + 0.3f * FastMath::sin(ambientPhase2 * 0.5f));
+
+            float amb = (l1 + l2 + l3) * mod + wind * 0.2f;
+
+            mono += amb * ambientVolume;
+            ambientPhase += 2.0f * M_PI * ambientFreq * dt;
+            ambientPhase2 += 2.0f * M_PI * 0.15f * dt; // Slow 0.15Hz modulation
 
+            if (ambientPhase > 2.0f * M_PI * 100.0f) ambientPhase -= 2.0f * M_PI * 100.0f;
+            if (ambientPhase2 > 2.0f * M_PI * 100.0f) ambientPhase2 -= 2.0f * M_PI * 100.0f;
+
+            float outL = mono + left[f];
+            float outR = mono + right[f];
+
+            // Reverb / Delay
+            float delayed = delayBuffer[delayIdx];
+            outL += delayed * 0.3f;
+            outR += delayed * 0.35f; // Slight offset for stereo width
+            delayBuffer[delayIdx] = (outL + outR) * 0.5f * 0.4f; // Feedback
+            delayIdx = (delayIdx + 1) % 8820;
+
+            buffer[(b + f) * 2] = std::clamp(outL, -1.0f, 1.0f);
+            buffer[(b + f) * 2 + 1] = std::clamp(outR, -1.0f, 1.0f);
+        }
+    }
+}
+
+template <SoundType T>
+struct Voice {
+    static float sample(SoundInstance& s, float t, float dt) {
+        float val = 0;
+        float freq = s.freq;
+        float env = std::exp(-t * 5.0f) * (1.0f - t);
+
+        if constexpr (T == SoundType::SHOOT) {
+            float transient = ((float)rand() / RAND_MAX * 2.0f - 1.0f) * std::exp(-t * 100.0f);
+            float bodyFreq = freq * std::exp(-t * 15.0f);
+            float body = (FastMath::sin(s.phase) > 0 ? 0.8f : -0.8f) * std::exp(-t * 10.0f);
+            float tail = ((float)rand() / RAND_MAX * 2.0f - 1.0f) * std::exp(-t * 4.0f) * 0.4f;
+            val = (transient * 0.5f + body * 0.6f + tail * 0.3f);
+            s.phase += 2.0f * M_PI * bodyFreq * dt;
+        } else if constexpr (T == SoundType::STEP) {
+            float thud = FastMath::sin(s.phase) * std::exp(-t * 20.0f);
+            float scuff = ((float)rand() / RAND_MAX * 2.0f - 1.0f) * std::exp(-t * 30.0f) * 0.5f;
+            val = thud + scuff;
+            s.phase += 2.0f * M_PI * 80.0f * dt;
+        } else if constexpr (T == SoundType::DASH) {
+            float noise = ((float)rand() / RAND_MAX * 2.0f - 1.0f);
+            float sweep = std::exp(-t * 3.0f);
+            val = noise * sweep * FastMath::sin(s.phase);
+            s.phase += 2.0f * M_PI * (200.0f + 1000.0f * (1.0f - t)) * dt;
+        } else if constexpr (T == SoundType::RELOAD) {
+            float mechanical = (std::fmod(s.elapsed, 0.06f) < 0.015f) ? (FastMath::sin(s.phase) > 0 ? 1.0f : -1.0f) : 0;
+            val = mechanical * env;
+            s.phase += 2.0f * M_PI * 1200.0f * dt;
+        } else if constexpr (T == SoundType::HIT) {
+            float crunch = ((float)rand() / RAND_MAX * 2.0f - 1.0f) * std::exp(-t * 20.0f);
+            float impact = FastMath::sin(s.phase) * std::exp(-t * 10.0f);
+            val = crunch * 0.7f + impact * 0.5f;
+            s.phase += 2.0f * M_PI * freq * dt;
+        } else if constexpr (T == SoundType::PICKUP) {
+            float harmonic = FastMath::sin(s.phase) + 0.5f * FastMath::sin(s.phase * 2.01f) + 0.25f * FastMath::sin(s.phase * 3.02f);
+            val = harmonic * env;
+            s.phase += 2.0f * M_PI * freq * (1.0f + t) * dt;
+        } else if constexpr (T == SoundType::SANITIZE) {
+            float pulse = FastMath::sin(2.0f * M_PI * 10.0f * s.elapsed);
+            float tone = FastMath::sin(s.phase) * (0.5f + 0.5f * pulse);
+            val = tone * (1.0f - t);
+            s.phase += 2.0f * M_PI * (freq - 200.0f * t) * dt;
+        } else if constexpr (T == SoundType::ALERT) {
+            val = (FastMath::sin(s.phase) > 0 ? 0.5f : -0.5f) * (FastMath::sin(2.0f * M_PI * 15.0f * s.elapsed) > 0 ? 1.0f : 0.0f);
+            s.phase += 2.0f * M_PI * freq * dt;
+        } else if constexpr (T == SoundType::RICOCHET) {
+            float ping = FastMath::sin(s.phase) * std::exp(-t * 25.0f);
+            float noise = ((float)rand() / RAND_MAX * 2.0f - 1.0f) * std::exp(-t * 40.0f);
+            val = ping * 0.6f + noise * 0.4f;
+            s.phase += 2.0f * M_PI * (freq + 1000.0f * t) * dt;
+        } else if constexpr (T == SoundType::EMPTY) {
+            val = (FastMath::sin(s.phase) > 0 ? 1.0f : -1.0f) * std::exp(-t * 50.0f);
+            s.phase += 2.0f * M_PI * 150.0f * dt;
+        } else if constexpr (T == SoundType::BOSS_PHASE) {
+            float sub = FastMath::sin(s.phase) * (1.0f - t);
+            float texture = ((float)rand() / RAND_MAX * 2.0f - 1.0f) * 0.2f * FastMath::sin(s.phase * 0.1f);
+            val = sub + texture;
+            s.phase += 2.0f * M_PI * (60.0f + 100.0f * t) * dt;
+        } else if constexpr (T == SoundType::UI_CLICK) {
+            val = ((float)rand() / RAND_MAX * 2.0f - 1.0f) * std::exp(-t * 80.0f);
+        } else if constexpr (T == SoundType::UI_CONFIRM) {
+            float f_sel = freq * (t < 0.5f ? 1.0f : 1.5f);
+            float sub = FastMath::sin(s.phase);
+            float harm1 = FastMath::sin(s.phase * 2.0f) * 0.5f;
+            float harm2 = FastMath::sin(s.phase * 3.0f) * 0.25f;
+            val = (sub + harm1 + harm2) * env;
+            s.phase += 2.0f * M_PI * f_sel * dt;
+        } else if constexpr (T == SoundType::EMP_SHOT) {
+            float buzz = (FastMath::sin(s.phase) * FastMath::sin(s.phase * 1.05f)) * (1.0f - t);
+            float crackle = ((float)rand() / RAND_MAX * 2.0f - 1.0f) * 0.3f * (1.0f - t);
+            val = buzz + crackle;
+            s.phase += 2.0f * M_PI * (freq + FastMath::sin(t * 50.0f) * 100.0f) * dt;
+        } else if constexpr (T == SoundType::PIERCE_SHOT) {
+            float whistle = FastMath::sin(s.phase) * std::exp(-t * 2.0f);
+            float heavy = (FastMath::sin(s.phase * 0.5f) > 0 ? 1.0f : -1.0f) * std::exp(-t * 10.0f);
+            val = whistle * 0.4f + heavy * 0.7f;
+            s.phase += 2.0f * M_PI * freq * std::exp(-t * 5.0f) * dt;
+        } else if constexpr (T == SoundType::SHIELD_DOWN) {
+            val = (FastMath::sin(s.phase) * FastMath::sin(s.phase * 0.5f)) * (1.0f - t);
+            s.phase += 2.0f * M_PI * (freq - 400.0f * t) * dt;
+        } else if constexpr (T == SoundType::LOW_ENERGY) {
+            val = FastMath::sin(s.phase) * (FastMath::sin(2.0f * M_PI * 10.0f * s.elapsed) > 0 ? 1.0f : 0.0f);
+            s.phase += 2.0f * M_PI * 1500.0f * dt;
+        } else if constexpr (T == SoundType::DRIP) {
+            val = FastMath::sin(s.phase) * std::exp(-t * 20.0f);
+            s.phase += 2.0f * M_PI * freq * dt;
+        } else if constexpr (T == SoundType::MACHINERY) {
+            val = (FastMath::sin(s.phase) > 0 ? 0.3f : -0.3f) * (0.8f + 0.2f * FastMath::sin(2.0f * M_PI * 2.0f * s.elapsed));
+            s.phase += 2.0f * M_PI * freq * dt;
+        } else if constexpr (T == SoundType::STEAM) {
+            val = ((float)rand() / RAND_MAX * 2.0f - 1.0f) * (1.0f - t) * (0.5f + 0.5f * FastMath::sin(s.phase));
+            s.phase += 2.0f * M_PI * 15.0f * dt;
+        } else if constexpr (T == SoundType::ECHO_VOICE) {
+            float v = FastMath::sin(s.phase) * FastMath::sin(s.phase * 0.11f) * FastMath::sin(s.phase * 0.05f);
+            val = v * (1.0f - t);
+            s.phase += 2.0f * M_PI * (freq + 50.0f * FastMath::sin(s.elapsed * 10.0f)) * dt;
+        } else if constexpr (T == SoundType::ZAP) {
+            val = (FastMath::sin(s.phase) > 0 ? 1.0f : -1.0f) * ((float)rand() / RAND_MAX);
+            s.phase += 2.0f * M_PI * freq * dt;
+        } else if constexpr (T == SoundType::SHIELD_CHARGE) {
+            val = FastMath::sin(s.phase) * t;
+            s.phase += 2.0f * M_PI * (freq + 400.0f * t) * dt;
+        } else if constexpr (T == SoundType::READY) {
+            float f_sel = freq * (std::fmod(s.elapsed, 0.1f) < 0.05f ? 1.0f : 1.2f);
+            val = FastMath::sin(s.phase) * env;
+            s.phase += 2.0f * M_PI * f_sel * dt;
+        } else if constexpr (T == SoundType::BOSS_DIE) {
+            float rumble = ((float)rand() / RAND_MAX * 2.0f - 1.0f) * (1.0f - t);
+            float sweep = FastMath::sin(s.phase) * std::exp(-t * 2.0f);
+            val = rumble * 0.7f + sweep * 0.3f;
+            s.phase += 2.0f * M_PI * (100.0f - 80.0f * t) * dt;
+        }
+        return val;
+    }
+};
+
+typedef float (*SampleFn)(SoundInstance&, float, float);
+typedef void (*KernelFn)(SoundInstance* const*, int, float*, float*, int, float);
+
+// Renders a group of same-type voices into a block: the type is fixed at compile time, so the inner
+// loop is the synth code alone
+template <SoundType T>
+static void renderGroup(SoundInstance* const* voices, int count, float* left, float* right, int frames, float dt) {
+    for (int i = 0; i < count; ++i) {
+        SoundInstance& s = *voices[i];
+        float gl = s.volume * std::min(1.0f, 1.0f - s.pan), gr = s.volume * std::min(1.0f, 1.0f + s.pan);
+        for (int f = 0; f < frames; ++f) {
+            float t = s.elapsed / s.duration;
+            if (t >= 1.0f) { s.active = false; break; }
+            float val = Voice<T>::sample(s, t, dt);
+            left[f] += val * gl; right[f] += val * gr;
+            s.elapsed += dt;
+        }
+    }
+}
+
+// Sample-bank voices: linear interpolation through the prerendered waveform, whatever their type
+static void renderPcm(SoundInstance* const* voices, int count, float* left, float* right, int frames, float dt) {
+    for (int i = 0; i < count; ++i) {
+        SoundInstance& s = *voices[i];
+        float gl = s.volume * std::min(1.0f, 1.0f - s.pan), gr = s.volume * std::min(1.0f, 1.0f + s.pan);
+        for (int f = 0; f < frames; ++f) {
+            int i0 = (int)s.pcmPos;
+            if (i0 + 1 >= s.pcmLen) { s.active = false; break; }
+            float val = s.pcm[i0] + (s.pcm[i0 + 1] - s.pcm[i0]) * (s.pcmPos - i0);
+            left[f] += val * gl; right[f] += val * gr;
+            s.pcmPos += s.pcmRate; s.elapsed += dt;
+        }
+    }
+}
+
+template <size_t... I>
+static constexpr std::array<SampleFn, sizeof...(I)> makeSampleTable(std::index_sequence<I...>) { return {{&Voice<(SoundType)I>::sample...}}; }
+template <size_t... I>
+static constexpr std::array<KernelFn, sizeof...(I)> makeKernelTable(std::index_sequence<I...>) { return {{&renderGroup<(SoundType)I>...}}; }
+static constexpr auto sampleTable = makeSampleTable(std::make_index_sequence<(size_t)SoundType::COUNT>());
+static constexpr auto kernelTable = makeKernelTable(std::make_index_sequence<(size_t)SoundType::COUNT>());
+
+float AudioManager::synthesize(SoundInstance& s, float t, float dt) { return sampleTable[(int)s.type](s, t, dt); }
+
+// Per-sample runtime dispatch: one type lookup per voice per sample. Kept for the benchmark.
+void AudioManager::mixDynamic(float* left, float* right, int frames, float dt) {
+    for (int f = 0; f < frames; ++f) {
         for (int i = 0; i < 32; ++i) {
             if (!sounds[i].active) continue;
             SoundInstance& s = sounds[i];
-            float t = s.elapsed / s.duration;
-            if (t >= 1.0f) { s.active = false; continue; }
-
-            float val = 0;
-            float freq = s.freq;
-            float env = std::exp(-t * 5.0f) * (1.0f - t);
-
-            if (s.type == SoundType::SHOOT) {
-                float transient = ((float)rand() / RAND_MAX * 2.0f - 1.0f) * std::exp(-t * 100.0f);
-                float bodyFreq = freq * std::exp(-t * 15.0f);
-                float body = (std::sin(s.phase) > 0 ? 0.8f : -0.8f) * std::exp(-t * 10.0f);
-                float tail = ((float)rand() / RAND_MAX * 2.0f - 1.0f) * std::exp(-t * 4.0f) * 0.4f;
-                val = (transient * 0.5f + body * 0.6f + tail * 0.3f);
-                s.phase += 2.0f * M_PI * bodyFreq * dt;
-            } else if (s.type == SoundType::STEP) {
-                float thud = std::sin(s.phase) * std::exp(-t * 20.0f);
-                float scuff = ((float)rand() / RAND_MAX * 2.0f - 1.0f) * std::exp(-t * 30.0f) * 0.5f;
-                val = thud + scuff;
-                s.phase += 2.0f * M_PI * 80.0f * dt;
-            } else if (s.type == SoundType::DASH) {
-                float noise = ((float)rand() / RAND_MAX * 2.0f - 1.0f);
-                float sweep = std::exp(-t * 3.0f);
-                val = noise * sweep * std::sin(s.phase);
-                s.phase += 2.0f * M_PI * (200.0f + 1000.0f * (1.0f - t)) * dt;
-            } else if (s.type == SoundType::RELOAD) {
-                float mechanical = (std::fmod(s.elapsed, 0.06f) < 0.015f) ? (std::sin(s.phase) > 0 ? 1.0f : -1.0f) : 0;
-                val = mechanical * env;
-                s.phase += 2.0f * M_PI * 1200.0f * dt;
-            } else if (s.type == SoundType::HIT) {
-                float crunch = ((float)rand() / RAND_MAX * 2.0f - 1.0f) * std::exp(-t * 20.0f);
-                float impact = std::sin(s.phase) * std::exp(-t * 10.0f);
-                val = crunch * 0.7f + impact * 0.5f;
-                s.phase += 2.0f * M_PI * freq * dt;
-            } else if (s.type == SoundType::PICKUP) {
-                float harmonic = std::sin(s.phase) + 0.5f * std::sin(s.phase * 2.01f) + 0.25f * std::sin(s.phase * 3.02f);
-                val = harmonic * env;
-                s.phase += 2.0f * M_PI * freq * (1.0f + t) * dt;
-            } else if (s.type == SoundType::SANITIZE) {
-                float pulse = std::sin(2.0f * M_PI * 10.0f * s.elapsed);
-                float tone = std::sin(s.phase) * (0.5f + 0.5f * pulse);
-                val = tone * (1.0f - t);
-                s.phase += 2.0f * M_PI * (freq - 200.0f * t) * dt;
-            } else if (s.type == SoundType::ALERT) {
-                val = (std::sin(s.phase) > 0 ? 0.5f : -0.5f) * (std::sin(2.0f * M_PI * 15.0f * s.elapsed) > 0 ? 1.0f : 0.0f);
-                s.phase += 2.0f * M_PI * freq * dt;
-            } else if (s.type == SoundType::RICOCHET) {
-                float ping = std::sin(s.phase) * std::exp(-t * 25.0f);
-                float noise = ((float)rand() / RAND_MAX * 2.0f - 1.0f) * std::exp(-t * 40.0f);
-                val = ping * 0.6f + noise * 0.4f;
-                s.phase += 2.0f * M_PI * (freq + 1000.0f * t) * dt;
-            } else if (s.type == SoundType::EMPTY) {
-                val = (std::sin(s.phase) > 0 ? 1.0f : -1.0f) * std::exp(-t * 50.0f);
-                s.phase += 2.0f * M_PI * 150.0f * dt;
-            } else if (s.type == SoundType::BOSS_PHASE) {
-                float sub = std::sin(s.phase) * (1.0f - t);
-                float texture = ((float)rand() / RAND_MAX * 2.0f - 1.0f) * 0.2f * std::sin(s.phase * 0.1f);
-                val = sub + texture;
-                s.phase += 2.0f * M_PI * (60.0f + 100.0f * t) * dt;
-            } else if (s.type == SoundType::UI_CLICK) {
-                val = ((float)rand() / RAND_MAX * 2.0f - 1.0f) * std::exp(-t * 80.0f);
-            } else if (s.type == SoundType::UI_CONFIRM) {
-                float f_sel = freq * (t < 0.5f ? 1.0f : 1.5f);
-                float sub = std::sin(s.phase);
-                float harm1 = std::sin(s.phase * 2.0f) * 0.5f;
-                float harm2 = std::sin(s.phase * 3.0f) * 0.25f;
-                val = (sub + harm1 + harm2) * env;
-                s.phase += 2.0f * M_PI * f_sel * dt;
-            } else if (s.type == SoundType::EMP_SHOT) {
-                float buzz = (std::sin(s.phase) * std::sin(s.phase * 1.05f)) * (1.0f - t);
-                float crackle = ((float)rand() / RAND_MAX * 2.0f - 1.0f) * 0.3f * (1.0f - t);
-                val = buzz + crackle;
-                s.phase += 2.0f * M_PI * (freq + std::sin(t * 50.0f) * 100.0f) * dt;
-            } else if (s.type == SoundType::PIERCE_SHOT) {
-                float whistle = std::sin(s.phase) * std::exp(-t * 2.0f);
-                float heavy = (std::sin(s.phase * 0.5f) > 0 ? 1.0f : -1.0f) * std::exp(-t * 10.0f);
-                val = whistle * 0.4f + heavy * 0.7f;
-                s.phase += 2.0f * M_PI * freq * std::exp(-t * 5.0f) * dt;
-            } else if (s.type == SoundType::SHIELD_DOWN) {
-                val = (std::sin(s.phase) * std::sin(s.phase * 0.5f)) * (1.0f - t);
-                s.phase += 2.0f * M_PI * (freq - 400.0f * t) * dt;
-            } else if (s.type == SoundType::LOW_ENERGY) {
-                val = std::sin(s.phase) * (std::sin(2.0f * M_PI * 10.0f * s.elapsed) > 0 ? 1.0f : 0.0f);
-                s.phase += 2.0f * M_PI * 1500.0f * dt;
-            } else if (s.type == SoundType::DRIP) {
-                val = std::sin(s.phase) * std::exp(-t * 20.0f);
-                s.phase += 2.0f * M_PI * freq * dt;
-            } else if (s.type == SoundType::MACHINERY) {
-                val = (std::sin(s.phase) > 0 ? 0.3f : -0.3f) * (0.8f + 0.2f * std::sin(2.0f * M_PI * 2.0f * s.elapsed));
-                s.phase += 2.0f * M_PI * freq * dt;
-            } else if (s.type == SoundType::STEAM) {
-                val = ((float)rand() / RAND_MAX * 2.0f - 1.0f) * (1.0f - t) * (0.5f + 0.5f * std::sin(s.phase));
-                s.phase += 2.0f * M_PI * 15.0f * dt;
-            } else if (s.type == SoundType::ECHO_VOICE) {
-                float v = std::sin(s.phase) * std::sin(s.phase * 0.11f) * std::sin(s.phase * 0.05f);
-                val = v * (1.0f - t);
-                s.phase += 2.0f * M_PI * (freq + 50.0f * std::sin(s.elapsed * 10.0f)) * dt;
-            } else if (s.type == SoundType::ZAP) {
-                val = (std::sin(s.phase) > 0 ? 1.0f : -1.0f) * ((float)rand() / RAND_MAX);
-                s.phase += 2.0f * M_PI * freq * dt;
-            } else if (s.type == SoundType::SHIELD_CHARGE) {
-                val = std::sin(s.phase) * t;
-                s.phase += 2.0f * M_PI * (freq + 400.0f * t) * dt;
-            } else if (s.type == SoundType::READY) {
-                float f_sel = freq * (std::fmod(s.elapsed, 0.1f) < 0.05f ? 1.0f : 1.2f);
-                val = std::sin(s.phase) * env;
-                s.phase += 2.0f * M_PI * f_sel * dt;
-            } else if (s.type == SoundType::BOSS_DIE) {
-                float rumble = ((float)rand() / RAND_MAX * 2.0f - 1.0f) * (1.0f - t);
-                float sweep = std::sin(s.phase) * std::exp(-t * 2.0f);
-                val = rumble * 0.7f + sweep * 0.3f;
-                s.phase += 2.0f * M_PI * (100.0f - 80.0f * t) * dt;
+            float val;
+            if (s.pcm) {
+                int i0 = (int)s.pcmPos;
+                if (i0 + 1 >= s.pcmLen) { s.active = false; continue; }
+                float fr = s.pcmPos - i0;
+                val = s.pcm[i0] + (s.pcm[i0 + 1] - s.pcm[i0]) * fr;
+                s.pcmPos += s.pcmRate;
+            } else {
+                float t = s.elapsed / s.duration;
+                if (t >= 1.0f) { s.active = false; continue; }
+                val = synthesize(s, t, dt);
             }
-
             float sVol = val * s.volume;
-            left += sVol * std::min(1.0f, 1.0f - s.pan);
-            right += sVol * std::min(1.0f, 1.0f + s.pan);
+            left[f] += sVol * std::min(1.0f, 1.0f - s.pan);
+            right[f] += sVol * std::min(1.0f, 1.0f + s.pan);
             s.elapsed += dt;
         }
+    }
+}
 
-        float outL = mono + left;
-        float outR = mono + right;
+// Voices grouped by type once per block, then each group through its compile-time kernel
+void AudioManager::mixGrouped(float* left, float* right, int frames, float dt) {
+    SoundInstance* groups[(int)SoundType::COUNT + 1][32];
+    int sizes[(int)SoundType::COUNT + 1] = {};
+    const int PCM = (int)SoundType::COUNT;
+    for (int i = 0; i < 32; ++i) {
+        if (!sounds[i].active) continue;
+        int g = sounds[i].pcm ? PCM : (int)sounds[i].type;
+        groups[g][sizes[g]++] = &sounds[i];
+    }
+    for (int g = 0; g < PCM; ++g) if (sizes[g]) kernelTable[g](groups[g], sizes[g], left, right, frames, dt);
+    if (sizes[PCM]) renderPcm(groups[PCM], sizes[PCM], left, right, frames, dt);
+}
 
-        // Reverb / Delay
-        float delayed = delayBuffer[delayIdx];
-        outL += delayed * 0.3f;
-        outR += delayed * 0.35f; // Slight offset for stereo width
-        delayBuffer[delayIdx] = (outL + outR) * 0.5f * 0.4f; // Feedback
-        delayIdx = (delayIdx + 1) % 8820;
+static float bankPitch(int k) { return AudioManager::BANK_MIN_PITCH * std::exp2(k / (float)AudioManager::BANK_STEPS_PER_OCTAVE); }
 
-        buffer[f * 2] = std::clamp(outL, -1.0f, 1.0f);
-        buffer[f * 2 + 1] = std::clamp(outR, -1.0f, 1.0f);
+static void renderSample(SoundType type, float freq, std::vector<float>& out) {
+    SoundInstance s;
+    s.type = type; s.freq = freq; s.phase = s.phase2 = s.elapsed = 0; s.duration = durationOf(type);
+    const float dt = 1.0f / AudioManager::SAMPLE_RATE;
+    out.clear();
+    for (float t = 0.0f; t < 1.0f; t = s.elapsed / s.duration) { out.push_back(AudioManager::synthesize(s, t, dt)); s.elapsed += dt; }
+}
+
+// Short one-shots that differ only in pitch are rendered once per ladder step; the rest stay synthesized
+void AudioManager::buildSampleBank() {
+    for (SoundType t : {SoundType::STEP, SoundType::UI_CLICK, SoundType::EMPTY, SoundType::LOW_ENERGY}) {
+        renderSample(t, 0.0f, bank[(int)t].pcm[0]); // These ignore freq
+        bank[(int)t].pitches = 1;
+    }
+    for (SoundType t : {SoundType::RICOCHET, SoundType::ZAP, SoundType::DRIP}) {
+        for (int k = 0; k < BANK_PITCHES; ++k) renderSample(t, bankPitch(k), bank[(int)t].pcm[k]);
+        bank[(int)t].pitches = BANK_PITCHES;
+    }
+}
+
+// Points a voice at the nearest prerendered pitch and the playback rate that corrects the rest
+void AudioManager::bankLookup(SoundType type, float freq, SoundInstance& s) const {
+    const SampleSet& set = bank[(int)type];
+    s.pcm = nullptr;
+    if (!useSampleBank || !set.pitches) return;
+    int k = 0;
+    s.pcmRate = 1.0f;
+    if (set.pitches > 1) {
+        k = std::clamp((int)std::lround(BANK_STEPS_PER_OCTAVE * std::log2(std::max(freq, 1.0f) / BANK_MIN_PITCH)), 0, set.pitches - 1);
+        s.pcmRate = std::clamp(freq / bankPitch(k), 0.5f, 2.0f);
     }
-}
\ No newline at end of file
+    s.pcm = set.pcm[k].data(); s.pcmLen = (int)set.pcm[k].size(); s.pcmPos = 0.0f;
+}
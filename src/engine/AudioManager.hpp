@@ -10,7 +10,7 @@ enum class SoundType {
     SHOOT, STEP, DASH, RELOAD, HIT, PICKUP, POWERUP, SANITIZE, ALERT,
     RICOCHET, EMPTY, BOSS_PHASE, UI_CLICK, UI_CONFIRM, EMP_SHOT, PIERCE_SHOT,
     SHIELD_DOWN, LOW_ENERGY, DRIP, MACHINERY, STEAM, ECHO_VOICE, ZAP,
-    SHIELD_CHARGE, READY, BOSS_DIE
+    SHIELD_CHARGE, READY, BOSS_DIE, COUNT
 };
 
 struct SoundInstance {
@@ -23,20 +23,36 @@ struct SoundInstance {
     float freq;
     float pan;
     bool active = false;
+    const float* pcm = nullptr; // Prerendered waveform from the sample bank, or null to synthesize
+    int pcmLen = 0;
+    float pcmPos = 0.0f, pcmRate = 1.0f;
 };
 
 enum class AmbientState { STANDARD, BATTLE, BOSS };
 
 class AudioManager {
 public:
+    static const int SAMPLE_RATE = 44100;
+    static const int BANK_PITCHES = 20; // Sample bank pitch ladder: quarter-octave steps from BANK_MIN_PITCH
+    static const int BANK_STEPS_PER_OCTAVE = 4;
+    static constexpr float BANK_MIN_PITCH = 100.0f;
+    static constexpr int MIX_BLOCK = 256; // Frames mixed per voice-grouping pass
+
+    bool useSampleBank = true;
+    bool useVoiceKernels = true; // Per-type template kernels; false mixes with per-sample runtime dispatch
+    uint32_t played = 0; // Every play() request; game thread only
+
     AudioManager();
     ~AudioManager();
+    void init();
     void play(SoundType type, float vol = 0.2f, float freq = 440.0f, float pan = 0.0f);
     void setAmbientState(AmbientState state);
     static void audioCallback(void* userdata, Uint8* stream, int len);
+    void buildSampleBank();
+    static float synthesize(SoundInstance& s, float t, float dt);
 
 private:
-    SDL_AudioDeviceID device;
+    SDL_AudioDeviceID device = 0;
     SoundInstance sounds[32];
     float ambientPhase = 0.0f;
     float ambientPhase2 = 0.0f;
@@ -47,8 +63,14 @@ private:
     float delayBuffer[8820];
     int delayIdx = 0;
     
+    struct SampleSet { std::vector<float> pcm[BANK_PITCHES]; int pitches = 0; };
+    SampleSet bank[(int)SoundType::COUNT];
+
     std::mutex audioMutex;
     void fillBuffer(float* buffer, int samples);
+    void mixDynamic(float* left, float* right, int frames, float dt);
+    void mixGrouped(float* left, float* right, int frames, float dt);
+    void bankLookup(SoundType type, float freq, SoundInstance& s) const;
 };
 
 #endif
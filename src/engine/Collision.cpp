@@ -0,0 +1,39 @@
+#include "Collision.hpp"
+#include "../core/Constants.hpp"
+#include <algorithm>
+#include <cmath>
+
+SweepHit sweepAABB(const Rect& box, const Vec2& delta, const std::vector<std::vector<Tile>>& map) {
+    SweepHit best;
+    int h = (int)map.size(), w = h ? (int)map[0].size() : 0;
+    // Broadphase: only tiles overlapped by the box swept over the whole move
+    float x0 = std::min(box.x, box.x + delta.x), x1 = std::max(box.x + box.w, box.x + box.w + delta.x);
+    float y0 = std::min(box.y, box.y + delta.y), y1 = std::max(box.y + box.h, box.y + box.h + delta.y);
+    int minX = std::max(0, (int)std::floor(x0 / TILE_SIZE)), maxX = std::min(w - 1, (int)std::floor(x1 / TILE_SIZE));
+    int minY = std::max(0, (int)std::floor(y0 / TILE_SIZE)), maxY = std::min(h - 1, (int)std::floor(y1 / TILE_SIZE));
+
+    for (int ty = minY; ty <= maxY; ++ty) {
+        for (int tx = minX; tx <= maxX; ++tx) {
+            if (map[ty][tx].type != WALL) continue;
+            float wx = (float)tx * TILE_SIZE, wy = (float)ty * TILE_SIZE;
+            float xEntry, xExit, yEntry, yExit;
+            if (delta.x > 0) { xEntry = (wx - (box.x + box.w)) / delta.x; xExit = (wx + TILE_SIZE - box.x) / delta.x; }
+            else if (delta.x < 0) { xEntry = (wx + TILE_SIZE - box.x) / delta.x; xExit = (wx - (box.x + box.w)) / delta.x; }
+            else if (box.x < wx + TILE_SIZE && box.x + box.w > wx) { xEntry = -INFINITY; xExit = INFINITY; }
+            else continue;
+            if (delta.y > 0) { yEntry = (wy - (box.y + box.h)) / delta.y; yExit = (wy + TILE_SIZE - box.y) / delta.y; }
+            else if (delta.y < 0) { yEntry = (wy + TILE_SIZE - box.y) / delta.y; yExit = (wy - (box.y + box.h)) / delta.y; }
+            else if (box.y < wy + TILE_SIZE && box.y + box.h > wy) { yEntry = -INFINITY; yExit = INFINITY; }
+            else continue;
+
+            float entry = std::max(xEntry, yEntry), exit = std::min(xExit, yExit);
+            // Boxes already overlapping a wall (entry < 0) are left to move out freely
+            if (entry > exit || entry < -0.0001f || entry >= best.t) continue;
+            best.hit = true;
+            best.t = std::max(0.0f, entry);
+            if (xEntry > yEntry) { best.nx = (delta.x > 0) ? -1 : 1; best.ny = 0; }
+            else { best.nx = 0; best.ny = (delta.y > 0) ? -1 : 1; }
+        }
+    }
+    return best;
+}
@@ -0,0 +1,19 @@
+#ifndef COLLISION_HPP
+#define COLLISION_HPP
+
+#include <vector>
+#include "../core/Vec2.hpp"
+#include "../core/Rect.hpp"
+#include "../core/Enums.hpp"
+
+struct SweepHit {
+    bool hit = false;
+    float t = 1.0f;     // Fraction of the move completed before contact
+    int nx = 0, ny = 0; // Surface normal of the wall face that was hit
+};
+
+// Swept AABB against the wall tiles of the grid. Returns the earliest time of impact in [0, 1]
+// for `box` travelling by `delta`, so no sub-stepping is needed at any speed.
+SweepHit sweepAABB(const Rect& box, const Vec2& delta, const std::vector<std::vector<Tile>>& map);
+
+#endif
@@ -10,6 +10,7 @@
 class Entity {
 public:
     Vec2 pos;
+    Vec2 prevPos; // Position at the start of the current sim step, for render interpolation
     Vec2 vel;
     Rect bounds;
     EntityType type;
@@ -21,7 +22,6 @@ public:
 
     virtual void update(float dt, const std::vector<std::vector<Tile>>& map);
     void move(Vec2 delta, const std::vector<std::vector<Tile>>& map);
-    void collideMap(const std::vector<std::vector<Tile>>& map, bool xAxis, float moveDir);
     virtual void render(SDL_Renderer* ren, const Vec2& cam);
 };
 
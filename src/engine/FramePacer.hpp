@@ -0,0 +1,85 @@
+#ifndef FRAMEPACER_HPP
+#define FRAMEPACER_HPP
+
+#include <SDL2/SDL.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include "../core/Constants.hpp"
+
+// Fixed-step accumulator on the high-resolution counter. Each rendered frame adds its real
+// duration; step() hands out SIM_DT ticks until the accumulator is drained, and alpha() is the
+// leftover fraction used to interpolate rendering between the last two sim states.
+class FramePacer {
+public:
+    static const int HISTORY = 240;
+    int fpsCap = 0; // 0 = present as fast as vsync/the display allows
+
+    void reset() { freq = SDL_GetPerformanceFrequency(); last = SDL_GetPerformanceCounter(); accumulator = 0.0; steps = 0; }
+
+    void beginFrame() {
+        Uint64 now = SDL_GetPerformanceCounter();
+        double sec = (double)(now - last) / freq;
+        last = now;
+        intervals[frames % HISTORY] = (float)(sec * 1000.0);
+        frames++;
+        // Clamp long stalls (window drag, breakpoint) instead of fast-forwarding through them
+        accumulator += std::min(sec, MAX_SIM_STEPS * (double)SIM_DT);
+        steps = 0;
+    }
+    bool step() {
+        if (accumulator < SIM_DT) return false;
+        if (steps == MAX_SIM_STEPS) { droppedTime += accumulator; accumulator = 0.0; return false; }
+        tickStart = frameTime() - accumulator; tickEnd = tickStart + SIM_DT;
+        accumulator -= SIM_DT; steps++; totalSteps++;
+        return true;
+    }
+    float alpha() const { return (float)(accumulator / SIM_DT); }
+    // Real-time window (seconds, performance counter clock) that the current step stands for
+    double frameTime() const { return (double)last / freq; }
+    double tickStart = 0.0, tickEnd = 0.0;
+
+    // Sleeps most of the remaining frame time, then spins the last ~1.5ms for accuracy.
+    void limit() {
+        if (fpsCap <= 0) return;
+        Uint64 target = last + freq / fpsCap;
+        for (;;) {
+            Uint64 now = SDL_GetPerformanceCounter();
+            if (now >= target) break;
+            double remainMs = (double)(target - now) * 1000.0 / freq;
+            if (remainMs > 1.5) SDL_Delay((Uint32)(remainMs - 1.0));
+        }
+    }
+
+    struct Jitter { float meanMs = 0, stdDevMs = 0, p99Ms = 0, maxMs = 0; };
+    Jitter jitter() const {
+        Jitter j;
+        int n = frames < HISTORY ? frames : HISTORY;
+        if (n < 2) return j;
+        float sorted[HISTORY];
+        std::copy(intervals, intervals + n, sorted);
+        double sum = 0.0, sq = 0.0;
+        for (int i = 0; i < n; ++i) sum += sorted[i];
+        j.meanMs = (float)(sum / n);
+        for (int i = 0; i < n; ++i) sq += (sorted[i] - j.meanMs) * (sorted[i] - j.meanMs);
+        j.stdDevMs = (float)std::sqrt(sq / (n - 1));
+        std::sort(sorted, sorted + n);
+        j.p99Ms = sorted[std::min(n - 1, (int)(n * 0.99f))];
+        j.maxMs = sorted[n - 1];
+        return j;
+    }
+    void report(FILE* out) const {
+        Jitter j = jitter();
+        fprintf(out, "frames: %d, sim steps: %llu, frame %.2fms mean, %.2fms stddev, %.2fms p99, %.2fms max, %.1fms sim time dropped\n",
+                frames, (unsigned long long)totalSteps, j.meanMs, j.stdDevMs, j.p99Ms, j.maxMs, droppedTime * 1000.0);
+    }
+
+private:
+    Uint64 freq = 1, last = 0;
+    double accumulator = 0.0, droppedTime = 0.0;
+    int steps = 0, frames = 0;
+    uint64_t totalSteps = 0;
+    float intervals[HISTORY] = {};
+};
+
+#endif
@@ -0,0 +1,54 @@
+#include "InputHandler.hpp"
+#include <algorithm>
+
+InputHandler::InputHandler() {
+    std::fill(std::begin(bindings), std::end(bindings), Action::COUNT);
+    bind(SDL_SCANCODE_W, Action::MOVE_UP); bind(SDL_SCANCODE_S, Action::MOVE_DOWN);
+    bind(SDL_SCANCODE_A, Action::MOVE_LEFT); bind(SDL_SCANCODE_D, Action::MOVE_RIGHT);
+    bind(SDL_SCANCODE_LSHIFT, Action::DASH); bind(SDL_SCANCODE_R, Action::RELOAD);
+    bind(SDL_SCANCODE_SPACE, Action::REFLEX); bind(SDL_SCANCODE_F, Action::PULSE);
+    bind(SDL_SCANCODE_1, Action::AMMO_STANDARD); bind(SDL_SCANCODE_2, Action::AMMO_EMP); bind(SDL_SCANCODE_3, Action::AMMO_PIERCING);
+    bind(SDL_SCANCODE_RETURN, Action::CONFIRM);
+    bind(SDL_SCANCODE_F1, Action::DEV_MODE); bind(SDL_SCANCODE_F2, Action::DEV_SKIP);
+    bind(SDL_SCANCODE_F3, Action::PROFILER); bind(SDL_SCANCODE_F4, Action::TRACE_EXPORT);
+    bind(SDL_SCANCODE_F5, Action::SNAPSHOT_SAVE); bind(SDL_SCANCODE_F9, Action::SNAPSHOT_LOAD);
+}
+
+// `now` is on the caller's clock (seconds). SDL stamps events in milliseconds, so each event is
+// placed at now minus its age.
+void InputHandler::pump(double now) {
+    Uint32 ticks = SDL_GetTicks();
+    SDL_Event e;
+    while (SDL_PollEvent(&e)) {
+        double t = now - (double)(Uint32)(ticks - e.common.timestamp) / 1000.0;
+        if (e.type == SDL_QUIT) quitRequested = true;
+        else if ((e.type == SDL_KEYDOWN || e.type == SDL_KEYUP) && !e.key.repeat) {
+            Action a = bindings[e.key.keysym.scancode];
+            if (a != Action::COUNT) push(a, e.type == SDL_KEYDOWN, t);
+        }
+        else if (e.type == SDL_MOUSEBUTTONDOWN) push(Action::FIRE, true, t);
+        else if (e.type == SDL_MOUSEBUTTONUP) push(Action::FIRE, false, t);
+        else if (e.type == SDL_MOUSEMOTION) { mPos.x = (float)e.motion.x; mPos.y = (float)e.motion.y; }
+    }
+}
+
+void InputHandler::beginTick(double tickStart, double tickEnd) {
+    std::fill(std::begin(pressPhase), std::end(pressPhase), 0);
+    uint32_t pressedThisTick = 0;
+    size_t used = 0;
+    for (; used < queue.size() && queue[used].time < tickEnd; ++used) {
+        const InputEvent& ev = queue[used];
+        uint32_t b = bit(ev.action);
+        if (!ev.down) {
+            // A tap shorter than a tick still registers: the release waits for the next tick
+            if (pressedThisTick & b) break;
+            actions &= ~b;
+            continue;
+        }
+        if (actions & b) continue;
+        actions |= b; pressedThisTick |= b;
+        double f = (ev.time - tickStart) / (tickEnd - tickStart);
+        pressPhase[(int)ev.action] = (uint8_t)std::clamp(f * 256.0, 0.0, 255.0);
+    }
+    queue.erase(queue.begin(), queue.begin() + used);
+}
@@ -2,34 +2,41 @@
 #define INPUTHANDLER_HPP
 
 #include <SDL2/SDL.h>
-#include <algorithm>
-#include <iterator>
+#include <cstdint>
+#include <vector>
 #include "../core/Vec2.hpp"
+#include "../core/Enums.hpp"
 
+struct InputEvent { Action action; bool down; double time; };
+
+// Maps SDL events to game actions. pump() timestamps events into a queue once per frame;
+// beginTick() folds the events that fall inside a sim step into the action bitset and records
+// how far into the step each new press happened, so firing is not quantized to the tick.
 class InputHandler {
 public:
-    bool keys[SDL_NUM_SCANCODES] = {false};
-    bool lastKeys[SDL_NUM_SCANCODES] = {false};
-    bool mDown = false;
+    static const int ACTION_COUNT = (int)Action::COUNT;
+
+    uint32_t actions = 0, lastActions = 0;
+    uint8_t pressPhase[ACTION_COUNT] = {}; // Fraction of the tick elapsed at the press, in 1/256ths
+    bool quitRequested = false;
     Vec2 mPos;
 
-    void update() {
-        std::copy(std::begin(keys), std::end(keys), std::begin(lastKeys));
-        SDL_Event e;
-        while (SDL_PollEvent(&e)) {
-            if (e.type == SDL_QUIT) exit(0);
-            if (e.type == SDL_KEYDOWN) keys[e.key.keysym.scancode] = true;
-            if (e.type == SDL_KEYUP) keys[e.key.keysym.scancode] = false;
-            if (e.type == SDL_MOUSEBUTTONDOWN) mDown = true;
-            if (e.type == SDL_MOUSEBUTTONUP) mDown = false;
-            if (e.type == SDL_MOUSEMOTION) {
-                mPos.x = (float)e.motion.x;
-                mPos.y = (float)e.motion.y;
-            }
-        }
-    }
-    bool isPressed(SDL_Scancode c) const { return keys[c]; }
-    bool isTriggered(SDL_Scancode c) const { return keys[c] && !lastKeys[c]; }
+    InputHandler();
+    void bind(SDL_Scancode sc, Action a) { bindings[sc] = a; }
+
+    void pump(double now);
+    void push(Action a, bool down, double time) { queue.push_back({a, down, time}); }
+    void beginTick(double tickStart, double tickEnd);
+    void endTick() { lastActions = actions; }
+
+    bool isPressed(Action a) const { return actions & bit(a); }
+    bool isTriggered(Action a) const { return (actions & bit(a)) && !(lastActions & bit(a)); }
+    float pressOffset(Action a) const { return pressPhase[(int)a] / 256.0f; }
+    static uint32_t bit(Action a) { return 1u << (int)a; }
+
+private:
+    Action bindings[SDL_NUM_SCANCODES];
+    std::vector<InputEvent> queue;
 };
 
 #endif
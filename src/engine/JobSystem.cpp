@@ -0,0 +1,77 @@
+#include "JobSystem.hpp"
+
+int& JobSystem::threadIndex() { thread_local int idx = 0; return idx; }
+
+JobSystem::JobSystem(int workers) {
+    if (workers < 0) workers = std::max(0, (int)std::thread::hardware_concurrency() - 1);
+    for (int i = 0; i <= workers; ++i) queues.push_back(new Queue());
+    for (int i = 1; i <= workers; ++i) threads.emplace_back([this, i] { workerLoop(i); });
+}
+
+JobSystem::~JobSystem() {
+    { std::lock_guard<std::mutex> l(sleepLock); quit = true; }
+    wake.notify_all();
+    for (auto& t : threads) t.join();
+    for (auto q : queues) delete q;
+}
+
+void JobSystem::submit(const Job& job) {
+    job.counter->pending.fetch_add(1, std::memory_order_relaxed);
+    if (threads.empty()) { run(job); return; }
+    Queue& q = *queues[threadIndex() < (int)queues.size() ? threadIndex() : 0];
+    bool pushed = false;
+    {
+        std::lock_guard<std::mutex> l(q.lock);
+        if (q.size < QUEUE_CAPACITY) { q.jobs[(q.head + q.size) % QUEUE_CAPACITY] = job; q.size++; pushed = true; }
+    }
+    if (!pushed) { run(job); return; } // Queue full: execute inline
+    queued.fetch_add(1, std::memory_order_release);
+    { std::lock_guard<std::mutex> l(sleepLock); }
+    wake.notify_one();
+}
+
+bool JobSystem::pop(int self, Job& out) {
+    Queue& q = *queues[self];
+    std::lock_guard<std::mutex> l(q.lock);
+    if (q.size == 0) return false;
+    q.size--; out = q.jobs[(q.head + q.size) % QUEUE_CAPACITY];
+    queued.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool JobSystem::steal(int self, Job& out) {
+    int n = (int)queues.size();
+    for (int i = 1; i < n; ++i) {
+        Queue& q = *queues[(self + i) % n];
+        std::lock_guard<std::mutex> l(q.lock);
+        if (q.size == 0) continue;
+        out = q.jobs[q.head]; q.head = (q.head + 1) % QUEUE_CAPACITY; q.size--;
+        queued.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+    return false;
+}
+
+void JobSystem::run(const Job& job) {
+    job.fn(job.ctx, job.begin, job.end);
+    job.counter->pending.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+void JobSystem::wait(JobCounter& counter) {
+    int self = threadIndex() < (int)queues.size() ? threadIndex() : 0;
+    Job job;
+    while (counter.pending.load(std::memory_order_acquire) > 0) {
+        if (pop(self, job) || steal(self, job)) run(job);
+        else std::this_thread::yield();
+    }
+}
+
+void JobSystem::workerLoop(int self) {
+    threadIndex() = self;
+    Job job;
+    while (!quit) {
+        if (pop(self, job) || steal(self, job)) { run(job); continue; }
+        std::unique_lock<std::mutex> l(sleepLock);
+        wake.wait(l, [this] { return quit || queued.load(std::memory_order_acquire) > 0; });
+    }
+}
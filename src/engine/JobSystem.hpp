@@ -0,0 +1,66 @@
+#ifndef JOBSYSTEM_HPP
+#define JOBSYSTEM_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct JobCounter { std::atomic<int> pending{0}; };
+
+struct Job {
+    void (*fn)(void* ctx, int begin, int end);
+    void* ctx;
+    int begin, end;
+    JobCounter* counter;
+};
+
+// Work-stealing pool. Each thread owns a bounded deque: owners push/pop at the back,
+// idle threads steal from the front. The calling thread is queue 0 and helps while waiting.
+class JobSystem {
+public:
+    explicit JobSystem(int workers = -1);
+    ~JobSystem();
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    int threadCount() const { return (int)queues.size(); }
+    void submit(const Job& job);
+    void wait(JobCounter& counter);
+
+    // dispatch() splits [0, count) into fixed chunks of `grain`. Chunk boundaries do not depend on the
+    // thread count, so per-chunk output merged in chunk order is deterministic.
+    template <typename F>
+    void dispatch(JobCounter& counter, int count, int grain, F& body) {
+        for (int b = 0; b < count; b += grain) {
+            submit({[](void* ctx, int begin, int end) { (*(F*)ctx)(begin, end); }, &body, b, std::min(count, b + grain), &counter});
+        }
+    }
+    template <typename F>
+    void parallelFor(int count, int grain, F& body) { JobCounter counter; dispatch(counter, count, grain, body); wait(counter); }
+    static int chunkCount(int count, int grain) { return (count + grain - 1) / grain; }
+
+private:
+    static const int QUEUE_CAPACITY = 1024;
+    struct Queue {
+        std::mutex lock;
+        Job jobs[QUEUE_CAPACITY];
+        int head = 0, size = 0;
+    };
+    std::vector<Queue*> queues;
+    std::vector<std::thread> threads;
+    std::mutex sleepLock;
+    std::condition_variable wake;
+    std::atomic<int> queued{0};
+    std::atomic<bool> quit{false};
+
+    bool pop(int self, Job& out);
+    bool steal(int self, Job& out);
+    void run(const Job& job);
+    void workerLoop(int self);
+    static int& threadIndex();
+};
+
+#endif
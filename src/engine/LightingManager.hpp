@@ -7,21 +7,31 @@
 #include "../core/Constants.hpp"
 #include "../core/Vec2.hpp"
 #include "../core/Enums.hpp"
+#include "LineOfSight.hpp"
 
 class LightingManager {
 public:
+    static const int LIGHTMAP_SCALE = 4; // Screen pixels per lightmap texel, per axis
+    static const int LIGHT_RAYS = 180;
+
     std::vector<std::vector<float>> lMap;
     SDL_Texture* glowTex = nullptr;
     SDL_Texture* shadowMask = nullptr;
+    SDL_Texture* lightMap = nullptr; // Low-res render target all point lights accumulate into
+    std::vector<SDL_Vertex> lightVerts;
+    Vec2 rayDirs[LIGHT_RAYS]; // Fixed fan, so the trig runs once
 
     LightingManager() {
+        for (int i = 0; i < LIGHT_RAYS; ++i) { float a = (float)(i * 2) * 0.0174f; rayDirs[i] = {std::cos(a), std::sin(a)}; }
         lMap.resize(MAP_HEIGHT);
         for (auto& r : lMap) r.assign(MAP_WIDTH, 0.0f);
+        lightVerts.reserve(6 * 512);
     }
 
     ~LightingManager() {
         if (glowTex) SDL_DestroyTexture(glowTex);
         if (shadowMask) SDL_DestroyTexture(shadowMask);
+        if (lightMap) SDL_DestroyTexture(lightMap);
     }
 
     void init(SDL_Renderer* ren) {
@@ -37,7 +47,7 @@ public:
                 float dist = std::sqrt(dx * dx + dy * dy);
                 float maxDist = sz / 2.0f;
                 float t = std::max(0.0f, 1.0f - (dist / maxDist));
-                float alpha = std::pow(t, 3.0f); // Natural falloff
+                float alpha = t * t * t; // Natural falloff
                 pixels[y * sz + x] = SDL_MapRGBA(s->format, 255, 255, 255, (Uint8)(alpha * 255));
             }
         }
@@ -50,22 +60,20 @@ public:
         SDL_SetTextureBlendMode(shadowMask, SDL_BLENDMODE_BLEND);
         SDL_SetTextureScaleMode(shadowMask, SDL_ScaleModeLinear);
         SDL_SetTextureScaleMode(glowTex, SDL_ScaleModeLinear);
+
+        lightMap = SDL_CreateTexture(ren, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_TARGET, SCREEN_WIDTH / LIGHTMAP_SCALE, SCREEN_HEIGHT / LIGHTMAP_SCALE);
+        SDL_SetTextureBlendMode(lightMap, SDL_BLENDMODE_ADD);
+        SDL_SetTextureScaleMode(lightMap, SDL_ScaleModeLinear);
     }
 
     void update(const Vec2& cp, const std::vector<std::vector<Tile>>& map) {
         for (auto& r : lMap) std::fill(r.begin(), r.end(), 0.08f); // Ambient floor
-        for (int i = 0; i < 360; i += 2) {
-            float a = (float)i * 0.0174f;
-            float c = std::cos(a), s = std::sin(a), d = 0;
-            while (d < 500.0f) {
-                d += 10.0f;
-                int tx = (int)((cp.x + c * d) / TILE_SIZE), ty = (int)((cp.y + s * d) / TILE_SIZE);
-                if (tx >= 0 && tx < MAP_WIDTH && ty >= 0 && ty < MAP_HEIGHT) {
-                    float v = 1.0f - (d / 500.0f);
-                    if (v > lMap[ty][tx]) lMap[ty][tx] = v;
-                    if (map[ty][tx].type == WALL) break;
-                } else break;
-            }
+        for (int i = 0; i < LIGHT_RAYS; ++i) {
+            LineOfSight::traverse(map, cp, rayDirs[i], 500.0f, [&](int tx, int ty, float d) {
+                float v = 1.0f - (d / 500.0f);
+                if (v > lMap[ty][tx]) lMap[ty][tx] = v;
+                return map[ty][tx].type != WALL;
+            });
         }
     }
 
@@ -94,12 +102,34 @@ public:
         SDL_RenderCopy(ren, shadowMask, &src, &dst);
     }
 
-    void drawPointLight(SDL_Renderer* ren, Vec2 p, float rad, SDL_Color c, float intensity) {
-        if (!glowTex) return;
-        SDL_SetTextureColorMod(glowTex, c.r, c.g, c.b);
-        SDL_SetTextureAlphaMod(glowTex, (Uint8)intensity);
-        SDL_Rect r = { (int)(p.x - rad), (int)(p.y - rad), (int)rad * 2, (int)rad * 2 };
-        SDL_RenderCopy(ren, glowTex, NULL, &r);
+    // Queues a light for this frame's lightmap: screen-space centre, radius and peak alpha.
+    // Colour and intensity ride on the vertices, so lights never touch texture mod state.
+    void addLight(Vec2 p, float rad, SDL_Color c, float intensity) {
+        const float s = 1.0f / LIGHTMAP_SCALE;
+        float x0 = (p.x - rad) * s, y0 = (p.y - rad) * s, x1 = (p.x + rad) * s, y1 = (p.y + rad) * s;
+        SDL_Color vc = {c.r, c.g, c.b, (Uint8)intensity};
+        SDL_Vertex q[4] = {{{x0, y0}, vc, {0, 0}}, {{x1, y0}, vc, {1, 0}}, {{x1, y1}, vc, {1, 1}}, {{x0, y1}, vc, {0, 1}}};
+        for (int i : {0, 1, 2, 0, 2, 3}) lightVerts.push_back(q[i]);
+    }
+
+    // Draws every queued light into the lightmap with a single geometry call and empties the queue
+    void buildLightMap(SDL_Renderer* ren) {
+        if (lightMap && glowTex) {
+            SDL_Texture* prev = SDL_GetRenderTarget(ren);
+            SDL_SetRenderTarget(ren, lightMap);
+            SDL_SetRenderDrawColor(ren, 0, 0, 0, 255);
+            SDL_RenderClear(ren);
+            if (!lightVerts.empty()) SDL_RenderGeometry(ren, glowTex, lightVerts.data(), (int)lightVerts.size(), nullptr, 0);
+            SDL_SetRenderTarget(ren, prev);
+        }
+        lightVerts.clear();
+    }
+
+    // Adds the lightmap over the whole screen; alpha scales the contribution so one map serves every layer
+    void compositeLightMap(SDL_Renderer* ren, Uint8 alpha) {
+        if (!lightMap) return;
+        SDL_SetTextureAlphaMod(lightMap, alpha);
+        SDL_RenderCopy(ren, lightMap, NULL, NULL);
     }
 };
 
@@ -0,0 +1,53 @@
+#include "LineOfSight.hpp"
+#include <cstdlib>
+#include <utility>
+
+bool LineOfSight::visible(const Vec2& a, const Vec2& b, const std::vector<std::vector<Tile>>& map) {
+    return visibleTiles((int)std::floor(a.x / TILE_SIZE), (int)std::floor(a.y / TILE_SIZE),
+                        (int)std::floor(b.x / TILE_SIZE), (int)std::floor(b.y / TILE_SIZE), map);
+}
+
+bool LineOfSight::visibleTiles(int ax, int ay, int bx, int by, const std::vector<std::vector<Tile>>& map) {
+    int h = (int)map.size(), w = h ? (int)map[0].size() : 0;
+    if (ax < 0 || ax >= w || ay < 0 || ay >= h || bx < 0 || bx >= w || by < 0 || by >= h) return false;
+    // The traversal below is symmetric, so (a,b) and (b,a) share one cache slot
+    if (ax > bx || (ax == bx && ay > by)) { std::swap(ax, bx); std::swap(ay, by); }
+    uint64_t key = ((uint64_t)(uint16_t)ax << 48) | ((uint64_t)(uint16_t)ay << 32) | ((uint64_t)(uint16_t)bx << 16) | (uint64_t)(uint16_t)by;
+    uint64_t hsh = key * 0x9E3779B97F4A7C15ull;
+    int slot = -1;
+    for (int i = 0; i < 8; ++i) {
+        CacheEntry& e = cache[(size_t)((hsh >> 52) + i) & (CACHE_SIZE - 1)];
+        if (e.gen != generation) { slot = (int)(((hsh >> 52) + i) & (CACHE_SIZE - 1)); break; }
+        if (e.key == key) { cacheHits++; return e.visible; }
+    }
+    cacheMisses++;
+
+    // Integer Amanatides-Woo walk between tile centres. Exact corner crossings are blocked
+    // if either side tile is a wall, so rays never slip diagonally between two walls.
+    int dx = std::abs(bx - ax), dy = std::abs(by - ay), sx = (bx > ax) ? 1 : -1, sy = (by > ay) ? 1 : -1;
+    int x = ax, y = ay, ix = 0, iy = 0;
+    bool vis = true;
+    while (vis && (ix < dx || iy < dy)) {
+        int decision = (1 + 2 * ix) * dy - (1 + 2 * iy) * dx;
+        if (decision == 0) {
+            if (map[y][x + sx].type == WALL || map[y + sy][x].type == WALL) { vis = false; break; }
+            x += sx; y += sy; ix++; iy++;
+        } else if (decision < 0) { x += sx; ix++; }
+        else { y += sy; iy++; }
+        if (map[y][x].type == WALL && !(x == bx && y == by)) vis = false;
+    }
+
+    if (slot >= 0) { cache[slot].key = key; cache[slot].gen = generation; cache[slot].visible = vis; }
+    return vis;
+}
+
+RayHit LineOfSight::raycast(const Vec2& origin, const Vec2& dir, float maxDist, const std::vector<std::vector<Tile>>& map) const {
+    RayHit r;
+    r.dist = traverse(map, origin, dir, maxDist, [&](int tx, int ty, float t) {
+        if (map[ty][tx].type != WALL) return true;
+        r.hit = true; r.tx = tx; r.ty = ty; r.dist = t;
+        return false;
+    });
+    r.point = origin + dir * r.dist;
+    return r;
+}
@@ -0,0 +1,56 @@
+#ifndef LINEOFSIGHT_HPP
+#define LINEOFSIGHT_HPP
+
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include "../core/Constants.hpp"
+#include "../core/Vec2.hpp"
+#include "../core/Enums.hpp"
+
+struct RayHit {
+    bool hit = false;
+    int tx = -1, ty = -1;
+    float dist = 0.0f;
+    Vec2 point;
+};
+
+// Exact grid traversal (Amanatides & Woo) shared by AI, lighting and audio.
+// Tile-pair visibility is memoized until the next beginFrame().
+class LineOfSight {
+public:
+    void beginFrame() { if (++generation == 0) { for (auto& e : cache) e.gen = 0; generation = 1; } }
+    bool visible(const Vec2& a, const Vec2& b, const std::vector<std::vector<Tile>>& map);
+    bool visibleTiles(int ax, int ay, int bx, int by, const std::vector<std::vector<Tile>>& map);
+    RayHit raycast(const Vec2& origin, const Vec2& dir, float maxDist, const std::vector<std::vector<Tile>>& map) const;
+
+    int cacheHits = 0, cacheMisses = 0;
+
+    // Visits every tile the ray passes through, in order, with the distance at which it is entered.
+    // visit(tx, ty, tEnter) returns false to stop. Returns the distance travelled.
+    template <typename Visit>
+    static float traverse(const std::vector<std::vector<Tile>>& map, const Vec2& o, const Vec2& dir, float maxDist, Visit visit) {
+        int h = (int)map.size(), w = h ? (int)map[0].size() : 0;
+        int tx = (int)std::floor(o.x / TILE_SIZE), ty = (int)std::floor(o.y / TILE_SIZE);
+        int stepX = (dir.x > 0) ? 1 : (dir.x < 0 ? -1 : 0), stepY = (dir.y > 0) ? 1 : (dir.y < 0 ? -1 : 0);
+        float tMaxX = stepX ? (((stepX > 0 ? tx + 1 : tx) * (float)TILE_SIZE) - o.x) / dir.x : INFINITY;
+        float tMaxY = stepY ? (((stepY > 0 ? ty + 1 : ty) * (float)TILE_SIZE) - o.y) / dir.y : INFINITY;
+        float tDeltaX = stepX ? TILE_SIZE / std::abs(dir.x) : INFINITY, tDeltaY = stepY ? TILE_SIZE / std::abs(dir.y) : INFINITY;
+        float t = 0.0f;
+        while (tx >= 0 && tx < w && ty >= 0 && ty < h) {
+            if (!visit(tx, ty, t)) return t;
+            if (tMaxX < tMaxY) { t = tMaxX; tMaxX += tDeltaX; tx += stepX; }
+            else { t = tMaxY; tMaxY += tDeltaY; ty += stepY; }
+            if (t > maxDist) return maxDist;
+        }
+        return t;
+    }
+
+private:
+    struct CacheEntry { uint64_t key = 0; uint32_t gen = 0; bool visible = false; };
+    static const int CACHE_SIZE = 4096;
+    std::vector<CacheEntry> cache = std::vector<CacheEntry>(CACHE_SIZE);
+    uint32_t generation = 1;
+};
+
+#endif
@@ -0,0 +1,73 @@
+#include "Metrics.hpp"
+
+const char* const FrameMetrics::PHASE_NAMES[PHASES] = {"frame", "update", "updateAI", "simulate", "updateSlugs", "stream", "render", "lighting", "hud.render"};
+const char* const FrameMetrics::COUNTER_NAMES[COUNTERS] = {"ticks", "cores", "drones", "swarms", "bosses", "echoes", "items", "slugs",
+                                                           "particles", "paths", "sounds", "sprites", "text_draws", "text_rasters"};
+
+bool MetricsLog::open(const std::string& path) {
+    close();
+    file = fopen(path.c_str(), "wb");
+    if (!file) return false;
+    Header h = {MAGIC, VERSION, FrameMetrics::PHASES, FrameMetrics::COUNTERS};
+    fwrite(&h, sizeof(h), 1, file);
+    quit = false; pending = false; droppedFrames = 0;
+    writer = std::thread([this] { writeLoop(); });
+    return true;
+}
+
+void MetricsLog::close() {
+    if (!file) return;
+    {
+        std::lock_guard<std::mutex> l(lock);
+        quit = true;
+    }
+    wake.notify_one();
+    writer.join();
+    fwrite(batch.data(), sizeof(FrameMetrics), batch.size(), file); // Writer is gone: the partial batch is ours
+    batch.clear();
+    fclose(file);
+    file = nullptr;
+    if (droppedFrames) fprintf(stderr, "metrics: %u frames dropped while the writer was behind\n", droppedFrames);
+}
+
+void MetricsLog::push(const FrameMetrics& m) {
+    if (!file) return;
+    batch.push_back(m);
+    if ((int)batch.size() < BATCH) return;
+    {
+        std::lock_guard<std::mutex> l(lock);
+        if (pending) { droppedFrames += BATCH; batch.clear(); return; } // Disk stalled: shed the batch
+        batch.swap(writing);
+        pending = true;
+    }
+    wake.notify_one();
+}
+
+void MetricsLog::writeLoop() {
+    std::unique_lock<std::mutex> l(lock);
+    for (;;) {
+        wake.wait(l, [this] { return quit || pending; });
+        if (pending) {
+            l.unlock();
+            fwrite(writing.data(), sizeof(FrameMetrics), writing.size(), file);
+            fflush(file);
+            writing.clear();
+            l.lock();
+            pending = false;
+        }
+        if (quit) return;
+    }
+}
+
+bool MetricsLog::read(const std::string& path, std::vector<FrameMetrics>& out) {
+    FILE* f = fopen(path.c_str(), "rb");
+    if (!f) return false;
+    Header h;
+    bool ok = fread(&h, sizeof(h), 1, f) == 1 && h.magic == MAGIC && h.version == VERSION &&
+              h.phases == FrameMetrics::PHASES && h.counters == FrameMetrics::COUNTERS;
+    out.clear();
+    FrameMetrics m;
+    while (ok && fread(&m, sizeof(m), 1, f) == 1) out.push_back(m);
+    fclose(f);
+    return ok;
+}
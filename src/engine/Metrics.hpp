@@ -0,0 +1,59 @@
+#ifndef METRICS_HPP
+#define METRICS_HPP
+
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// One frame of counters and phase timings. Fixed-size POD, written as-is.
+struct FrameMetrics {
+    enum Phase { FRAME, UPDATE, AI, SIMULATE, SLUGS, STREAM, RENDER, LIGHTING, HUD, PHASES };
+    enum Counter { TICKS, CORES, DRONES, SWARMS, BOSSES, ECHOES, ITEMS, SLUGS_LIVE, PARTICLES, PATHS, SOUNDS, SPRITES, TEXT_DRAWS, TEXT_RASTERS, COUNTERS };
+    static const char* const PHASE_NAMES[PHASES];
+    static const char* const COUNTER_NAMES[COUNTERS];
+
+    uint32_t frame = 0;
+    float us[PHASES] = {};
+    uint32_t count[COUNTERS] = {};
+};
+
+// Per-frame metrics stream for offline stutter analysis (tools/metrics.cpp). push() copies the record
+// into a batch; full batches are handed to a writer thread, so the game thread never touches the
+// file. If the writer falls a whole batch behind, frames are dropped and counted rather than waited on.
+class MetricsLog {
+public:
+    static const uint32_t MAGIC = 0x544D4352; // "RCMT"
+    static const uint32_t VERSION = 1;
+    static const int BATCH = 120;
+    struct Header { uint32_t magic, version, phases, counters; };
+
+    MetricsLog() { batch.reserve(BATCH); writing.reserve(BATCH); }
+    ~MetricsLog() { close(); }
+    MetricsLog(const MetricsLog&) = delete;
+    MetricsLog& operator=(const MetricsLog&) = delete;
+
+    bool open(const std::string& path);
+    void close(); // Writes what is pending, stops the writer and reports dropped frames on stderr
+    bool isOpen() const { return file != nullptr; }
+    void push(const FrameMetrics& m);
+    uint32_t dropped() const { return droppedFrames; }
+
+    static bool read(const std::string& path, std::vector<FrameMetrics>& out);
+
+private:
+    FILE* file = nullptr;
+    std::vector<FrameMetrics> batch, writing; // Swapped, never reallocated
+    std::mutex lock;
+    std::condition_variable wake;
+    bool quit = false, pending = false;
+    uint32_t droppedFrames = 0;
+    std::thread writer;
+
+    void writeLoop();
+};
+
+#endif
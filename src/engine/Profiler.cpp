@@ -0,0 +1,112 @@
+#include "Profiler.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <vector>
+
+Profiler& Profiler::get() { static Profiler instance; return instance; }
+
+static int threadId() {
+    static std::atomic<int> next{0};
+    thread_local int id = next.fetch_add(1);
+    return id;
+}
+
+int& Profiler::allocZone() { thread_local int z = UNTAGGED; return z; }
+
+void Profiler::recordAlloc(size_t bytes) {
+    int z = allocZone();
+    allocCount[z].fetch_add(1, std::memory_order_relaxed);
+    allocBytes[z].fetch_add(bytes, std::memory_order_relaxed);
+    if (allocGuard.load(std::memory_order_relaxed)) {
+        allocGuard.store(false, std::memory_order_relaxed);
+        fprintf(stderr, "alloc guard: %zu bytes allocated in zone '%s' during a steady-state tick\n", bytes, z == UNTAGGED ? "(untagged)" : names[z]);
+        abort();
+    }
+}
+
+int Profiler::zone(const char* name) {
+    std::lock_guard<std::mutex> l(registerLock);
+    int n = zones.load(std::memory_order_relaxed);
+    for (int i = 0; i < n; ++i) if (!strcmp(names[i], name)) return i;
+    if (n == MAX_ZONES) return MAX_ZONES - 1; // Overflow shares the last slot
+    names[n] = name;
+    zones.store(n + 1, std::memory_order_release);
+    return n;
+}
+
+void Profiler::record(int z, uint64_t startNs, uint64_t endNs) {
+    if (!enabled.load(std::memory_order_relaxed)) return;
+    current[z].fetch_add(endNs - startNs, std::memory_order_relaxed);
+    TraceEvent& e = trace[traceHead.fetch_add(1, std::memory_order_relaxed) & (TRACE_CAPACITY - 1)];
+    e.zone = z; e.tid = threadId(); e.startNs = startNs; e.durNs = endNs - startNs;
+}
+
+void Profiler::endFrame() {
+    float* row = history[frames % HISTORY];
+    for (int z = 0; z < MAX_ZONES; ++z) row[z] = current[z].exchange(0, std::memory_order_relaxed) / 1000.0f;
+    for (int z = 0; z <= MAX_ZONES; ++z) {
+        lastAllocs[z].count = allocCount[z].exchange(0, std::memory_order_relaxed);
+        lastAllocs[z].bytes = allocBytes[z].exchange(0, std::memory_order_relaxed);
+    }
+    frames++;
+}
+
+float Profiler::frameUs(int z, int framesAgo) const {
+    if (framesAgo >= framesRecorded()) return 0.0f;
+    return history[(frames - 1 - framesAgo) % HISTORY][z];
+}
+
+Profiler::Stats Profiler::stats(int z) const {
+    Stats s;
+    int n = framesRecorded();
+    if (!n) return s;
+    float samples[HISTORY];
+    double sum = 0.0;
+    for (int i = 0; i < n; ++i) { samples[i] = frameUs(z, i); sum += samples[i]; }
+    s.lastUs = samples[0];
+    s.meanUs = (float)(sum / n);
+    int k = std::min(n - 1, (int)(n * 0.99f));
+    std::nth_element(samples, samples + k, samples + n);
+    s.p99Us = samples[k];
+    return s;
+}
+
+// Writes the trace ring in Chrome's JSON trace format (chrome://tracing, Perfetto).
+// Call between frames so no job thread is writing to the ring.
+bool Profiler::writeChromeTrace(const std::string& path) const {
+    FILE* f = fopen(path.c_str(), "w");
+    if (!f) return false;
+    uint64_t head = traceHead.load(std::memory_order_acquire);
+    uint64_t first = head > (uint64_t)TRACE_CAPACITY ? head - TRACE_CAPACITY : 0;
+    fprintf(f, "{\"traceEvents\":[\n");
+    for (uint64_t i = first; i < head; ++i) {
+        const TraceEvent& e = trace[i & (TRACE_CAPACITY - 1)];
+        fprintf(f, "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}", i == first ? "" : ",\n",
+                names[e.zone], e.tid, (e.startNs - epochNs) / 1000.0, e.durNs / 1000.0);
+    }
+    fprintf(f, "\n],\"displayTimeUnit\":\"ms\"}\n");
+    return fclose(f) == 0;
+}
+
+#ifdef RECOIL_TRACK_ALLOCS
+// The array and nothrow forms forward to the primary ones; the sized deletes are defined too, since
+// their library versions are not guaranteed to reach a replaced operator delete
+void* operator new(size_t n) {
+    Profiler::get().recordAlloc(n);
+    if (void* p = malloc(n ? n : 1)) return p;
+    throw std::bad_alloc();
+}
+void* operator new(size_t n, std::align_val_t al) {
+    Profiler::get().recordAlloc(n);
+    size_t a = (size_t)al;
+    if (void* p = aligned_alloc(a, (n + a - 1) / a * a)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+void operator delete(void* p, size_t, std::align_val_t) noexcept { free(p); }
+#endif
@@ -0,0 +1,96 @@
+#ifndef PROFILER_HPP
+#define PROFILER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+#define PROFILE_CONCAT2(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT2(a, b)
+// Times the enclosing scope. Zones are registered once per call site.
+#define PROFILE_SCOPE(name) \
+    static const int PROFILE_CONCAT(profZone_, __LINE__) = Profiler::get().zone(name); \
+    ProfileScope PROFILE_CONCAT(profScope_, __LINE__)(PROFILE_CONCAT(profZone_, __LINE__))
+
+// Per-zone frame timings plus a trace ring for Chrome trace export. Recording is lock-free
+// and safe from job threads; endFrame() and the readers run on the main thread.
+class Profiler {
+public:
+    static const int MAX_ZONES = 32;
+    static const int HISTORY = 240;
+    static const int TRACE_CAPACITY = 1 << 16;
+
+    static const int UNTAGGED = MAX_ZONES; // Allocation slot for code outside any zone
+
+    struct Stats { float meanUs = 0, p99Us = 0, lastUs = 0; };
+    struct AllocStats { uint32_t count = 0; uint64_t bytes = 0; };
+
+    static Profiler& get();
+    static uint64_t nowNs() {
+        return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    int zone(const char* name);
+    void record(int zone, uint64_t startNs, uint64_t endNs);
+    void endFrame();
+
+    int zoneCount() const { return zones.load(std::memory_order_acquire); }
+    const char* zoneName(int z) const { return names[z]; }
+    Stats stats(int z) const;
+    float frameUs(int z, int framesAgo) const;
+    int framesRecorded() const { return frames < HISTORY ? frames : HISTORY; }
+    bool writeChromeTrace(const std::string& path) const;
+
+    // Heap allocations per zone, counted by the operator new hooks in builds with RECOIL_TRACK_ALLOCS.
+    // An allocation is charged to the innermost zone open on the allocating thread.
+    static int& allocZone();
+    void recordAlloc(size_t bytes);
+    AllocStats allocs(int z) const { return lastAllocs[z]; }
+    // While guarded, any allocation aborts with the offending zone (RECOIL_ASSERT_NO_ALLOCS builds)
+    void guardAllocs(bool on) { allocGuard.store(on, std::memory_order_relaxed); }
+    // Off for bulk runs, where many threads would otherwise contend on the shared zone counters
+    void setEnabled(bool on) { enabled.store(on, std::memory_order_relaxed); }
+
+private:
+    struct TraceEvent { int zone, tid; uint64_t startNs, durNs; };
+
+    std::mutex registerLock;
+    const char* names[MAX_ZONES] = {};
+    std::atomic<int> zones{0};
+    std::atomic<uint64_t> current[MAX_ZONES] = {};
+    float history[HISTORY][MAX_ZONES] = {};
+    int frames = 0;
+    TraceEvent trace[TRACE_CAPACITY];
+    std::atomic<uint64_t> traceHead{0};
+    uint64_t epochNs = nowNs();
+    std::atomic<uint32_t> allocCount[MAX_ZONES + 1] = {};
+    std::atomic<uint64_t> allocBytes[MAX_ZONES + 1] = {};
+    AllocStats lastAllocs[MAX_ZONES + 1];
+    std::atomic<bool> allocGuard{false};
+    std::atomic<bool> enabled{true};
+};
+
+class ProfileScope {
+public:
+#ifdef RECOIL_TRACK_ALLOCS
+    explicit ProfileScope(int zone) : zone(zone), start(Profiler::nowNs()), outer(Profiler::allocZone()) { Profiler::allocZone() = zone; }
+    ~ProfileScope() { Profiler::allocZone() = outer; Profiler::get().record(zone, start, Profiler::nowNs()); }
+#else
+    explicit ProfileScope(int zone) : zone(zone), start(Profiler::nowNs()) {}
+    ~ProfileScope() { Profiler::get().record(zone, start, Profiler::nowNs()); }
+#endif
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    int zone;
+    uint64_t start;
+#ifdef RECOIL_TRACK_ALLOCS
+    int outer;
+#endif
+};
+
+#endif
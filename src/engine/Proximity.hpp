@@ -0,0 +1,56 @@
+#ifndef PROXIMITY_HPP
+#define PROXIMITY_HPP
+
+#include <vector>
+#include "../core/Vec2.hpp"
+
+// Entity positions copied into flat x/y arrays, so the distance to one point is measured for all of
+// them in a single branch-free pass. Every radius question about that point is then a compare
+// against d2. Indices follow the build order.
+class ProximitySet {
+public:
+    static const int LANES = 4; // Arrays are padded to a whole number of lanes with far-away points
+    std::vector<float> xs, ys, d2;
+
+    void reserve(int n) { xs.reserve(n + LANES); ys.reserve(n + LANES); d2.reserve(n + LANES); }
+    int size() const { return count; }
+
+    template <typename F>
+    void build(int n, F posOf) {
+        count = n;
+        int padded = (n + LANES - 1) / LANES * LANES;
+        xs.resize(padded); ys.resize(padded);
+        for (int i = 0; i < n; ++i) { Vec2 p = posOf(i); xs[i] = p.x; ys[i] = p.y; }
+        for (int i = n; i < padded; ++i) xs[i] = ys[i] = FAR;
+    }
+
+    // A point that never passes a radius test, for entries that should be measured but never found
+    static Vec2 farPoint() { return {FAR, FAR}; }
+
+    // Squared distances from `from`; returns the smallest. The inner blocks are fixed-width and branch-free
+    // with no dependency across lanes: at the Makefile's -Og they run as short scalar loops, and at -O2
+    // and above the compiler turns them into packed math.
+    float measure(Vec2 from) {
+        d2.resize(xs.size());
+        const float* x = xs.data();
+        const float* y = ys.data();
+        float* out = d2.data();
+        float lo[LANES];
+        for (int k = 0; k < LANES; ++k) lo[k] = FAR * FAR;
+        for (size_t i = 0; i < xs.size(); i += LANES) {
+            float d[LANES];
+            for (int k = 0; k < LANES; ++k) { float dx = x[i + k] - from.x, dy = y[i + k] - from.y; d[k] = dx * dx + dy * dy; }
+            for (int k = 0; k < LANES; ++k) { out[i + k] = d[k]; lo[k] = d[k] < lo[k] ? d[k] : lo[k]; }
+        }
+        float nearest = lo[0];
+        for (int k = 1; k < LANES; ++k) nearest = lo[k] < nearest ? lo[k] : nearest;
+        return nearest;
+    }
+    bool within(int i, float r) const { return d2[i] < r * r; }
+
+private:
+    static constexpr float FAR = 1e15f; // Squares to ~1e30, so padding never passes a radius test
+    int count = 0;
+};
+
+#endif
@@ -0,0 +1,94 @@
+#include "Replay.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+namespace Replay {
+
+uint64_t hash(const uint8_t* data, size_t size) {
+    uint64_t h = 0xcbf29ce484222325ull; // FNV-1a
+    for (size_t i = 0; i < size; ++i) { h ^= data[i]; h *= 0x100000001b3ull; }
+    return h;
+}
+
+template <typename T>
+static void put(std::vector<uint8_t>& out, T v) {
+    size_t at = out.size(); out.resize(at + sizeof(T)); std::memcpy(out.data() + at, &v, sizeof(T));
+}
+
+template <typename T>
+static bool get(const std::vector<uint8_t>& in, size_t& at, T& v) {
+    if (in.size() - at < sizeof(T)) return false;
+    std::memcpy(&v, in.data() + at, sizeof(T)); at += sizeof(T);
+    return true;
+}
+
+void Recorder::begin(uint64_t s, uint8_t f) {
+    recording = true; seed = s; flags = f; ticks = 0; stream.clear();
+    prevActions = 0; prevX = prevY = 0;
+}
+
+void Recorder::record(const InputHandler& in, uint64_t stateHash) {
+    if (!recording) return;
+    int mx = (int)in.mPos.x, my = (int)in.mPos.y;
+    uint8_t flags = (mx != prevX || my != prevY ? MOUSE_MOVED : 0) | (in.actions != prevActions ? ACTIONS_CHANGED : 0) | (stateHash ? HAS_HASH : 0);
+    put(stream, flags);
+    if (flags & MOUSE_MOVED) { put(stream, (int16_t)mx); put(stream, (int16_t)my); prevX = mx; prevY = my; }
+    if (flags & ACTIONS_CHANGED) {
+        put(stream, in.actions);
+        uint32_t pressed = in.actions & ~prevActions;
+        for (int a = 0; a < InputHandler::ACTION_COUNT; ++a) if (pressed & (1u << a)) put(stream, in.pressPhase[a]);
+        prevActions = in.actions;
+    }
+    if (flags & HAS_HASH) put(stream, stateHash);
+    ticks++;
+}
+
+bool Recorder::save(const std::string& path) const {
+    std::vector<uint8_t> head;
+    put(head, MAGIC); put(head, VERSION); put(head, seed); put(head, flags); put(head, ticks);
+    FILE* f = fopen(path.c_str(), "wb");
+    if (!f) return false;
+    bool ok = fwrite(head.data(), 1, head.size(), f) == head.size() && fwrite(stream.data(), 1, stream.size(), f) == stream.size();
+    return (fclose(f) == 0) && ok;
+}
+
+bool Player::load(const std::string& path) {
+    FILE* f = fopen(path.c_str(), "rb");
+    if (!f) return false;
+    std::vector<uint8_t> data;
+    uint8_t chunk[65536];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) data.insert(data.end(), chunk, chunk + n);
+    fclose(f);
+    size_t pos = 0;
+    uint32_t magic = 0, version = 0;
+    if (!get(data, pos, magic) || !get(data, pos, version) || magic != MAGIC || version != VERSION) return false;
+    if (!get(data, pos, seed) || !get(data, pos, flags) || !get(data, pos, totalTicks)) return false;
+    stream.assign(data.begin() + pos, data.end());
+    at = 0; tick = 0;
+    return true;
+}
+
+bool Player::next(InputHandler& in, uint64_t& expectedHash) {
+    expectedHash = 0;
+    uint8_t flags;
+    if (tick >= totalTicks || !get(stream, at, flags)) return false;
+    in.endTick();
+    std::fill(std::begin(in.pressPhase), std::end(in.pressPhase), 0);
+    if (flags & MOUSE_MOVED) {
+        int16_t x = 0, y = 0; get(stream, at, x); get(stream, at, y);
+        in.mPos = {(float)x, (float)y};
+    }
+    if (flags & ACTIONS_CHANGED) {
+        uint32_t prev = in.actions;
+        get(stream, at, in.actions);
+        uint32_t pressed = in.actions & ~prev;
+        for (int a = 0; a < InputHandler::ACTION_COUNT; ++a) if (pressed & (1u << a)) get(stream, at, in.pressPhase[a]);
+    }
+    if (flags & HAS_HASH) get(stream, at, expectedHash);
+    tick++;
+    return true;
+}
+
+}
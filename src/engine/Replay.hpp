@@ -0,0 +1,60 @@
+#ifndef REPLAY_HPP
+#define REPLAY_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "InputHandler.hpp"
+
+// Per-tick input recording. Each tick stores only what changed since the previous one
+// (action bitset with sub-tick press phases, mouse position), plus an optional state hash
+// for desync checks.
+namespace Replay {
+
+const uint32_t MAGIC = 0x50524352; // "RCRP"
+const uint32_t VERSION = 9; // Bumped whenever simulation results change, so old recordings are rejected rather than desync
+const int HASH_INTERVAL = 30;
+
+enum TickFlags : uint8_t { MOUSE_MOVED = 1, ACTIONS_CHANGED = 2, HAS_HASH = 4 };
+enum SessionFlags : uint8_t { ENDURANCE = 1 }; // Game mode the session was started in
+
+uint64_t hash(const uint8_t* data, size_t size);
+
+class Recorder {
+public:
+    void begin(uint64_t seed, uint8_t flags = 0);
+    void record(const InputHandler& in, uint64_t stateHash);
+    bool save(const std::string& path) const;
+    bool active() const { return recording; }
+    uint32_t tickCount() const { return ticks; }
+
+private:
+    bool recording = false;
+    uint64_t seed = 0;
+    uint8_t flags = 0;
+    uint32_t ticks = 0;
+    std::vector<uint8_t> stream;
+    uint32_t prevActions = 0;
+    int prevX = 0, prevY = 0;
+};
+
+class Player {
+public:
+    uint64_t seed = 0;
+    uint8_t flags = 0;
+    uint32_t totalTicks = 0;
+
+    bool load(const std::string& path);
+    // Applies the next tick to `in`. Returns false at the end of the stream.
+    bool next(InputHandler& in, uint64_t& expectedHash);
+    uint32_t position() const { return tick; }
+
+private:
+    std::vector<uint8_t> stream;
+    size_t at = 0;
+    uint32_t tick = 0;
+};
+
+}
+
+#endif
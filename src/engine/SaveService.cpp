@@ -0,0 +1,103 @@
+#include "SaveService.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include "Snapshot.hpp"
+
+SaveService::~SaveService() {
+    if (!io.joinable()) return;
+    { std::lock_guard<std::mutex> l(lock); quit = true; }
+    wake.notify_one();
+    io.join();
+}
+
+void SaveService::submit(const std::string& path, uint32_t version, std::vector<uint8_t> payload) {
+    Header h = {MAGIC, version, (uint32_t)payload.size(), crc32(payload.data(), payload.size())};
+    std::vector<uint8_t> data(sizeof(h) + payload.size());
+    std::memcpy(data.data(), &h, sizeof(h));
+    if (!payload.empty()) std::memcpy(data.data() + sizeof(h), payload.data(), payload.size());
+    {
+        std::lock_guard<std::mutex> l(lock);
+        if (!io.joinable()) io = std::thread([this] { ioLoop(); }); // Started on first use: replays and bulk runners never save
+        auto it = std::find_if(queue.begin(), queue.end(), [&](const Request& r) { return r.path == path; });
+        if (it != queue.end()) it->data.swap(data);
+        else queue.push_back({path, std::move(data)});
+    }
+    wake.notify_one();
+}
+
+void SaveService::flush() {
+    std::unique_lock<std::mutex> l(lock);
+    idle.wait(l, [this] { return queue.empty() && !busy; });
+}
+
+void SaveService::ioLoop() {
+    std::unique_lock<std::mutex> l(lock);
+    for (;;) {
+        wake.wait(l, [this] { return quit || !queue.empty(); });
+        if (queue.empty()) return; // quit, and everything queued is written
+        Request r = std::move(queue.front());
+        queue.erase(queue.begin());
+        busy = true;
+        l.unlock();
+        bool ok = writeAtomic(r.path, r.data);
+        if (!ok) fprintf(stderr, "save: cannot write %s\n", r.path.c_str());
+        l.lock();
+        busy = false;
+        if (!ok) failed++;
+        if (queue.empty()) idle.notify_all();
+    }
+}
+
+bool SaveService::writeAtomic(const std::string& path, const std::vector<uint8_t>& data) {
+    std::string tmp = path + ".tmp";
+    int fd = open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) return false;
+    // A journal left behind would pass load()'s checksum even though it never reached the disk
+    auto fail = [&] { unlink(tmp.c_str()); return false; };
+    size_t done = 0;
+    while (done < data.size()) {
+        ssize_t n = write(fd, data.data() + done, data.size() - done);
+        if (n <= 0) { close(fd); return fail(); }
+        done += (size_t)n;
+    }
+    if (fsync(fd) != 0) { close(fd); return fail(); }
+    if (close(fd) != 0 || rename(tmp.c_str(), path.c_str()) != 0) return fail();
+    // The rename is only durable once the directory entry is
+    size_t slash = path.find_last_of('/');
+    std::string dir = slash == std::string::npos ? "." : path.substr(0, slash + 1);
+    int dfd = open(dir.c_str(), O_RDONLY);
+    if (dfd >= 0) { fsync(dfd); close(dfd); }
+    return true;
+}
+
+static bool readChecked(const std::string& path, uint32_t& version, std::vector<uint8_t>& payload) {
+    Snapshot::MappedFile f(path);
+    if (!f.valid() || f.size() < sizeof(SaveService::Header)) return false;
+    SaveService::Header h;
+    std::memcpy(&h, f.data(), sizeof(h));
+    if (h.magic != SaveService::MAGIC || h.size != f.size() - sizeof(h)) return false;
+    const uint8_t* body = f.data() + sizeof(h);
+    if (SaveService::crc32(body, h.size) != h.crc) return false;
+    version = h.version;
+    payload.assign(body, body + h.size);
+    return true;
+}
+
+bool SaveService::load(const std::string& path, uint32_t& version, std::vector<uint8_t>& payload) {
+    // A journal that passes its checksum is newer than the main file: the write was complete and
+    // only the rename was lost. A torn journal fails the check and the main file stands.
+    return readChecked(path + ".tmp", version, payload) || readChecked(path, version, payload);
+}
+
+uint32_t SaveService::crc32(const uint8_t* data, size_t size) {
+    static const struct Table {
+        uint32_t v[256];
+        Table() { for (uint32_t i = 0; i < 256; ++i) { uint32_t c = i; for (int k = 0; k < 8; ++k) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1; v[i] = c; } }
+    } table;
+    uint32_t c = 0xFFFFFFFFu;
+    for (size_t i = 0; i < size; ++i) c = table.v[(c ^ data[i]) & 0xFF] ^ (c >> 8);
+    return c ^ 0xFFFFFFFFu;
+}
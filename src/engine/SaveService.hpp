@@ -0,0 +1,46 @@
+#ifndef SAVESERVICE_HPP
+#define SAVESERVICE_HPP
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Crash-safe saves off the game thread. Callers serialize into a buffer and submit() it; an I/O
+// thread writes "<path>.tmp" (the journal), fsyncs it, renames it over <path> and fsyncs the
+// directory. A crash at any point leaves either the old file or a complete journal, and load()
+// picks whichever is newest and intact.
+class SaveService {
+public:
+    static const uint32_t MAGIC = 0x56534352; // "RCSV"
+    struct Header { uint32_t magic, version, size, crc; }; // version is the caller's payload schema
+
+    SaveService() {}
+    ~SaveService(); // Finishes queued writes
+    SaveService(const SaveService&) = delete;
+    SaveService& operator=(const SaveService&) = delete;
+
+    // Queues a write and returns at once; a newer submit for the same path replaces one still queued
+    void submit(const std::string& path, uint32_t version, std::vector<uint8_t> payload);
+    void flush(); // Blocks until everything submitted so far is on disk
+    uint32_t failures() const { return failed; }
+
+    static bool load(const std::string& path, uint32_t& version, std::vector<uint8_t>& payload);
+    static bool writeAtomic(const std::string& path, const std::vector<uint8_t>& data);
+    static uint32_t crc32(const uint8_t* data, size_t size);
+
+private:
+    struct Request { std::string path; std::vector<uint8_t> data; };
+    std::vector<Request> queue;
+    std::mutex lock;
+    std::condition_variable wake, idle;
+    bool quit = false, busy = false;
+    uint32_t failed = 0;
+    std::thread io; // Not started until the first submit()
+
+    void ioLoop();
+};
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef SIMEVENTS_HPP
+#define SIMEVENTS_HPP
+
+#include <algorithm>
+#include <vector>
+#include <SDL2/SDL.h>
+#include "../core/Vec2.hpp"
+#include "../core/SmallString.hpp"
+#include "AudioManager.hpp"
+
+// Presentation side effects of a tick, as POD events. Gameplay code emits them instead of calling
+// audio, VFX or the HUD, and Game::drainEvents() applies the whole batch once at the end of the tick.
+// Parallel jobs each fill their own bus, merged with append() afterwards.
+struct SoundEvent { SoundType type; bool spatial; Vec2 pos; float vol, freq, pan; int freqJitter; }; // Jitter is drawn when drained
+struct BurstEvent { Vec2 pos; int count; SDL_Color color; };
+struct TextEvent { Vec2 pos; SmallString<32> text; SDL_Color color; };
+struct LogEvent { const char* text; SDL_Color color; }; // Static strings only
+
+struct EventBus {
+    explicit EventBus(int soundCap = 32, int otherCap = 8) { sounds.reserve(soundCap); bursts.reserve(otherCap); texts.reserve(otherCap); logs.reserve(otherCap); }
+    std::vector<SoundEvent> sounds;
+    std::vector<BurstEvent> bursts;
+    std::vector<TextEvent> texts;
+    std::vector<LogEvent> logs;
+    float flash = 0.0f; // Strongest screen flash requested
+
+    void sound(SoundType t, float vol, float freq, float pan = 0.0f) { sounds.push_back({t, false, {0, 0}, vol, freq, pan, 0}); }
+    void spatial(SoundType t, Vec2 pos, float vol, float freq, int freqJitter = 0) { sounds.push_back({t, true, pos, vol, freq, 0.0f, freqJitter}); }
+    void burst(Vec2 pos, int count, SDL_Color c) { bursts.push_back({pos, count, c}); }
+    void text(Vec2 pos, const char* t, SDL_Color c) { texts.push_back({pos, t, c}); }
+    void log(const char* t, SDL_Color c = {200, 200, 255, 255}) { logs.push_back({t, c}); }
+    void triggerFlash(float a) { flash = std::max(flash, a); }
+
+    void append(const EventBus& o) {
+        sounds.insert(sounds.end(), o.sounds.begin(), o.sounds.end());
+        bursts.insert(bursts.end(), o.bursts.begin(), o.bursts.end());
+        texts.insert(texts.end(), o.texts.begin(), o.texts.end());
+        logs.insert(logs.end(), o.logs.begin(), o.logs.end());
+        flash = std::max(flash, o.flash);
+    }
+    void clear() { sounds.clear(); bursts.clear(); texts.clear(); logs.clear(); flash = 0.0f; }
+};
+
+#endif
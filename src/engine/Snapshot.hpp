@@ -0,0 +1,96 @@
+#ifndef SNAPSHOT_HPP
+#define SNAPSHOT_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Compact little-endian binary stream used for sector snapshots.
+namespace Snapshot {
+
+const uint32_t MAGIC = 0x4E534352; // "RCSN"
+const uint32_t VERSION = 4;
+
+class Writer {
+public:
+    std::vector<uint8_t> buf;
+
+    template <typename T>
+    void put(const T& v) {
+        static_assert(std::is_trivially_copyable<T>::value, "Snapshot::Writer::put needs a POD");
+        putBytes(&v, sizeof(T));
+    }
+    void putBytes(const void* p, size_t n) {
+        size_t at = buf.size(); buf.resize(at + n); std::memcpy(buf.data() + at, p, n);
+    }
+    template <typename T>
+    void putArray(const std::vector<T>& v) { put((uint32_t)v.size()); if (!v.empty()) putBytes(v.data(), v.size() * sizeof(T)); }
+};
+
+// Reads in place from a buffer (typically an mmap'd file). Any overrun latches ok = false
+// and returns zeroed values, so callers check ok once at the end.
+class Reader {
+public:
+    const uint8_t* p;
+    const uint8_t* end;
+    bool ok = true;
+
+    Reader(const uint8_t* data, size_t size) : p(data), end(data + size) {}
+    template <typename T>
+    T get() {
+        static_assert(std::is_trivially_copyable<T>::value, "Snapshot::Reader::get needs a POD");
+        T v; std::memset((void*)&v, 0, sizeof(T));
+        const uint8_t* src = view(sizeof(T));
+        if (src) std::memcpy((void*)&v, src, sizeof(T));
+        return v;
+    }
+    const uint8_t* view(size_t n) {
+        if (!ok || (size_t)(end - p) < n) { ok = false; return nullptr; }
+        const uint8_t* at = p; p += n; return at;
+    }
+    // Length of a list whose entries take at least minBytes each. A count the rest of the buffer
+    // cannot hold latches ok = false and reads as 0, so callers may size containers from it.
+    uint32_t getCount(size_t minBytes) {
+        uint32_t n = get<uint32_t>();
+        if (ok && (size_t)n * minBytes > (size_t)(end - p)) { ok = false; return 0; }
+        return n;
+    }
+    // Enums are stored at their full width; a value past `last` latches ok = false
+    template <typename E>
+    E getEnum(E last) {
+        long long v = (long long)get<typename std::underlying_type<E>::type>();
+        if (v < 0 || v > (long long)last) { ok = false; return E{}; }
+        return (E)v;
+    }
+    template <typename T>
+    void getArray(std::vector<T>& out) {
+        uint32_t n = get<uint32_t>();
+        const uint8_t* src = view((size_t)n * sizeof(T));
+        out.clear();
+        if (src && n) { out.resize(n); std::memcpy(out.data(), src, (size_t)n * sizeof(T)); }
+    }
+};
+
+bool writeFile(const std::string& path, const std::vector<uint8_t>& data);
+
+// Read-only memory map of a whole file; the mapping lives as long as the object.
+class MappedFile {
+public:
+    explicit MappedFile(const std::string& path);
+    ~MappedFile();
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    const uint8_t* data() const { return ptr; }
+    size_t size() const { return len; }
+    bool valid() const { return ptr != nullptr; }
+
+private:
+    const uint8_t* ptr = nullptr;
+    size_t len = 0;
+};
+
+}
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef SPATIALGRID_HPP
+#define SPATIALGRID_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "../core/Rect.hpp"
+
+// Uniform grid of item indices, binned by centre point and rebuilt with a counting sort, so a
+// rebuild is linear and allocation-free once warm. Items are binned by centre only: callers pad
+// query rects by the largest half-extent they care about.
+class SpatialGrid {
+public:
+    SpatialGrid(float cellSize, int cols, int rows) : cellSize(cellSize), cols(cols), rows(rows), cellStart(cols * rows + 1) {}
+
+    template <typename F>
+    void build(int count, F centreOf) {
+        cellOf.resize(count); items.resize(count);
+        std::fill(cellStart.begin(), cellStart.end(), 0);
+        for (int i = 0; i < count; ++i) { cellOf[i] = cellAt(centreOf(i)); cellStart[cellOf[i] + 1]++; }
+        for (size_t c = 1; c < cellStart.size(); ++c) cellStart[c] += cellStart[c - 1];
+        cursor.assign(cellStart.begin(), cellStart.end() - 1);
+        for (int i = 0; i < count; ++i) items[cursor[cellOf[i]]++] = i;
+    }
+
+    // Indices of items in every cell overlapping r, ascending so callers keep the source order
+    void query(const Rect& r, std::vector<int>& out) const {
+        out.clear();
+        int x0 = clampCol(r.x), x1 = clampCol(r.x + r.w), y0 = clampRow(r.y), y1 = clampRow(r.y + r.h);
+        for (int y = y0; y <= y1; ++y) for (int x = x0; x <= x1; ++x) {
+            int c = y * cols + x;
+            out.insert(out.end(), items.begin() + cellStart[c], items.begin() + cellStart[c + 1]);
+        }
+        std::sort(out.begin(), out.end());
+    }
+
+private:
+    float cellSize;
+    int cols, rows;
+    std::vector<int> cellStart, cursor, cellOf, items;
+
+    int clampCol(float x) const { return std::clamp((int)std::floor(x / cellSize), 0, cols - 1); }
+    int clampRow(float y) const { return std::clamp((int)std::floor(y / cellSize), 0, rows - 1); }
+    int cellAt(Vec2 p) const { return clampRow(p.y) * cols + clampCol(p.x); }
+};
+
+#endif
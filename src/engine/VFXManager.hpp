@@ -14,24 +14,29 @@ public:
     std::vector<Particle> particles;
 
     void triggerFlash(float a) { flashAlpha = a; }
-    void update(float dt) {
+    void update(float dt) { integrate(dt, 0, (int)particles.size()); finishUpdate(dt); }
+    // Split form for the job system: integrate() touches only [begin, end), finishUpdate() runs serially
+    void integrate(float dt, int begin, int end) {
+        for (int i = begin; i < end; ++i) { Particle& p = particles[i]; p.pos = p.pos + p.vel * dt; p.life -= dt; }
+    }
+    void finishUpdate(float dt) {
         if (flashAlpha > 0) flashAlpha -= 2.0f * dt;
-        for (auto& p : particles) { p.pos = p.pos + p.vel * dt; p.life -= dt; }
         particles.erase(std::remove_if(particles.begin(), particles.end(), [](const Particle& p) { return p.life <= 0; }), particles.end());
     }
     void spawnBurst(Vec2 p, int n, SDL_Color c) {
         for (int i = 0; i < n; ++i) {
-            float a = (float)(rand() % 360) * 0.0174f;
-            float s = 40.0f + (rand() % 120);
-            particles.push_back({p, {std::cos(a) * s, std::sin(a) * s}, 0.4f, 0.4f, c, 2.0f + (rand() % 2)});
+            float a = (float)(gameRand() % 360) * 0.0174f;
+            float s = 40.0f + (gameRand() % 120);
+            particles.push_back({p, {std::cos(a) * s, std::sin(a) * s}, 0.4f, 0.4f, c, 2.0f + (gameRand() % 2)});
         }
     }
     void render(SDL_Renderer* ren, const Vec2& cam) {
         SDL_SetRenderDrawBlendMode(ren, SDL_BLENDMODE_BLEND);
         for (const auto& p : particles) {
+            SDL_Rect r = {(int)(p.pos.x - cam.x), (int)(p.pos.y - cam.y), (int)p.size, (int)p.size};
+            if (r.x + r.w + 2 < 0 || r.y + r.h + 2 < 0 || r.x - 2 > SCREEN_WIDTH || r.y - 2 > SCREEN_HEIGHT) continue; // Off screen
             float alpha = (p.life / p.maxLife);
             SDL_SetRenderDrawColor(ren, p.color.r, p.color.g, p.color.b, (Uint8)(255 * alpha));
-            SDL_Rect r = {(int)(p.pos.x - cam.x), (int)(p.pos.y - cam.y), (int)p.size, (int)p.size};
             SDL_RenderFillRect(ren, &r);
             if (p.size > 2.5f) { // Glow for large particles
                 SDL_SetRenderDrawColor(ren, p.color.r, p.color.g, p.color.b, (Uint8)(100 * alpha));
@@ -0,0 +1,77 @@
+#include "World.hpp"
+
+void ChunkedWorld::reset(uint64_t seed) {
+    worldSeed = seed; clock = 0; generated = evicted = 0;
+    for (auto& s : slots) s.used = false;
+}
+
+uint64_t ChunkedWorld::chunkSeed(int cx, int cy) const {
+    uint64_t h = worldSeed ^ (chunkKey(cx, cy) * 0x9E3779B97F4A7C15ull);
+    h ^= h >> 31; h *= 0xBF58476D1CE4E5B9ull; h ^= h >> 29;
+    return h;
+}
+
+int ChunkedWorld::loadedChunks() const {
+    int n = 0;
+    for (const auto& s : slots) n += s.used;
+    return n;
+}
+
+const ChunkedWorld::Chunk& ChunkedWorld::chunk(int cx, int cy) {
+    Chunk* victim = &slots[0];
+    for (auto& s : slots) {
+        if (s.used && s.cx == cx && s.cy == cy) { s.lastUsed = ++clock; return s; }
+        if (!s.used) { if (victim->used) victim = &s; }
+        else if (victim->used && s.lastUsed < victim->lastUsed) victim = &s;
+    }
+    if (victim->used) evicted++;
+    victim->cx = cx; victim->cy = cy; victim->used = true; victim->lastUsed = ++clock;
+    generate(*victim);
+    generated++;
+    return *victim;
+}
+
+void ChunkedWorld::fillWindow(int cx, int cy, std::vector<std::vector<Tile>>& map) {
+    map.resize(MAP_HEIGHT);
+    for (int y = 0; y < MAP_HEIGHT; ++y) {
+        map[y].resize(MAP_WIDTH);
+        for (int x = 0; x < MAP_WIDTH; ++x) map[y][x].rect = {(float)x * TILE_SIZE, (float)y * TILE_SIZE, (float)TILE_SIZE, (float)TILE_SIZE};
+    }
+    for (int wy = 0; wy < WINDOW_H; ++wy) for (int wx = 0; wx < WINDOW_W; ++wx) {
+        const Chunk& c = chunk(cx + wx, cy + wy);
+        for (int y = 0; y < CHUNK; ++y) for (int x = 0; x < CHUNK; ++x) map[wy * CHUNK + y][wx * CHUNK + x].type = c.tiles[y][x];
+    }
+}
+
+// Each chunk owns a wall along its top and left edges with a doorway in the middle of each, and keeps
+// the centre cross open, so every chunk reaches all four neighbours. Obstacles go in the quadrants;
+// any floor they cut off from the cross is filled in.
+void ChunkedWorld::generate(Chunk& c) const {
+    Rng rng(chunkSeed(c.cx, c.cy));
+    const int mid = CHUNK / 2;
+    auto onCross = [&](int x, int y) { return x == mid - 1 || x == mid || y == mid - 1 || y == mid; };
+    for (int y = 0; y < CHUNK; ++y) for (int x = 0; x < CHUNK; ++x) {
+        bool edge = (x == 0 || y == 0) && !onCross(x, y);
+        c.tiles[y][x] = edge ? WALL : FLOOR;
+    }
+    for (int i = 0, n = 2 + rng.next() % 4; i < n; ++i) {
+        int w = 1 + rng.next() % 3, h = 1 + rng.next() % 3, x0 = 1 + rng.next() % (CHUNK - 1 - w), y0 = 1 + rng.next() % (CHUNK - 1 - h);
+        for (int y = y0; y < y0 + h; ++y) for (int x = x0; x < x0 + w; ++x) if (!onCross(x, y)) c.tiles[y][x] = WALL;
+    }
+    bool reach[CHUNK][CHUNK] = {};
+    int stack[CHUNK * CHUNK], top = 0;
+    stack[top++] = mid * CHUNK + mid; reach[mid][mid] = true;
+    while (top) {
+        int cur = stack[--top], cx = cur % CHUNK, cy = cur / CHUNK;
+        const int dx[] = {0, 0, 1, -1}, dy[] = {1, -1, 0, 0};
+        for (int i = 0; i < 4; ++i) {
+            int nx = cx + dx[i], ny = cy + dy[i];
+            if (nx < 0 || ny < 0 || nx >= CHUNK || ny >= CHUNK || reach[ny][nx] || c.tiles[ny][nx] == WALL) continue;
+            reach[ny][nx] = true; stack[top++] = ny * CHUNK + nx;
+        }
+    }
+    for (int y = 0; y < CHUNK; ++y) for (int x = 0; x < CHUNK; ++x) {
+        if (!reach[y][x]) c.tiles[y][x] = WALL;
+        else if (rng.next() % 100 < 2) c.tiles[y][x] = HAZARD_TILE;
+    }
+}
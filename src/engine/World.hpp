@@ -0,0 +1,39 @@
+#ifndef WORLD_HPP
+#define WORLD_HPP
+
+#include <cstdint>
+#include <vector>
+#include "../core/Constants.hpp"
+#include "../core/Enums.hpp"
+
+// Unbounded tile world for endurance mode. Chunks are generated on demand from (seed, cx, cy) with
+// their own RNG, so a chunk never depends on load order, and live in a fixed-size LRU cache.
+// Game::map stays a MAP_WIDTH x MAP_HEIGHT window into the world (see Game::streamWorld).
+class ChunkedWorld {
+public:
+    static const int CHUNK = 10; // Tiles per side; the window is a whole number of chunks
+    static const int WINDOW_W = MAP_WIDTH / CHUNK, WINDOW_H = MAP_HEIGHT / CHUNK;
+    static_assert(MAP_WIDTH % CHUNK == 0 && MAP_HEIGHT % CHUNK == 0, "window must be whole chunks");
+
+    struct Chunk { int cx = 0, cy = 0; uint64_t lastUsed = 0; bool used = false; TileType tiles[CHUNK][CHUNK]; };
+
+    explicit ChunkedWorld(int capacity = 4 * WINDOW_W * WINDOW_H) : slots(capacity) {}
+
+    void reset(uint64_t seed);
+    uint64_t seed() const { return worldSeed; }
+    const Chunk& chunk(int cx, int cy);
+    // Copies the window whose top-left chunk is (cx, cy) into map; tile rects stay in window space
+    void fillWindow(int cx, int cy, std::vector<std::vector<Tile>>& map);
+    static uint64_t chunkKey(int cx, int cy) { return ((uint64_t)(uint32_t)cx << 32) | (uint32_t)cy; }
+    uint64_t chunkSeed(int cx, int cy) const;
+
+    int loadedChunks() const;
+    uint64_t generated = 0, evicted = 0;
+
+private:
+    uint64_t worldSeed = 1, clock = 0;
+    std::vector<Chunk> slots; // Linear scan: the cache is a few dozen chunks
+    void generate(Chunk& c) const;
+};
+
+#endif
@@ -0,0 +1,46 @@
+#include "AIScheduler.hpp"
+#include <algorithm>
+
+bool AIScheduler::shouldThink(RogueCore* c, float distToPlayer, float dt) {
+    c->thinkTimer -= dt;
+    if (c->thinkTimer > 0) return false;
+    // Engaged cores decide every tick, the rest at a rate that falls off with distance
+    c->thinkTimer = (distToPlayer < 400.0f) ? 0.0f : (distToPlayer < 800.0f ? 0.1f : 0.25f);
+    return true;
+}
+
+void AIScheduler::requestReplan(RogueCore* c, float distToPlayer) {
+    if (c->replanQueued) return;
+    c->replanQueued = true;
+    queue.push_back({c, distToPlayer});
+}
+
+void AIScheduler::cancel(RogueCore* c) {
+    if (!c->replanQueued) return;
+    queue.erase(std::remove_if(queue.begin(), queue.end(), [c](const Request& r) { return r.core == c; }), queue.end());
+    c->replanQueued = false;
+}
+
+void AIScheduler::processReplans(const Vec2& target, const std::vector<std::vector<Tile>>& map) {
+    replansThisFrame = 0; spentUs = 0.0f; estimatedUs = 0.0f;
+    if (queue.empty()) return;
+    // Stable insertion sort: the queue is short and mostly ordered, and std::stable_sort allocates a buffer per call
+    for (size_t i = 1; i < queue.size(); ++i) {
+        Request r = queue[i]; size_t j = i;
+        for (; j > 0 && r.dist < queue[j - 1].dist; --j) queue[j] = queue[j - 1];
+        queue[j] = r;
+    }
+    Uint64 start = SDL_GetPerformanceCounter();
+    size_t served = 0;
+    // Always serve at least one request so the queue cannot stall on a slow frame
+    while (served < queue.size()) {
+        RogueCore* c = queue[served++].core;
+        c->replanQueued = false;
+        int nodes = c->calculatePath(target, map);
+        replansThisFrame++; replansTotal++;
+        estimatedUs += AI_PATH_BASE_US + nodes * AI_PATH_NODE_US;
+        if (estimatedUs >= budgetUs) break;
+    }
+    spentUs = (float)((SDL_GetPerformanceCounter() - start) * 1000000.0 / (double)SDL_GetPerformanceFrequency());
+    queue.erase(queue.begin(), queue.begin() + served);
+}
@@ -0,0 +1,35 @@
+#ifndef AISCHEDULER_HPP
+#define AISCHEDULER_HPP
+
+#include <vector>
+#include "../core/Constants.hpp"
+#include "Actor.hpp"
+
+// Spreads core replanning across frames under a microsecond budget and thins out
+// decision-making for cores far from the player (LOD). The budget is charged from a cost model
+// of the searches actually run, not the wall clock, so scheduling replays deterministically.
+class AIScheduler {
+public:
+    float budgetUs = AI_BUDGET_US;
+    int replansThisFrame = 0;
+    uint64_t replansTotal = 0;
+    float spentUs = 0.0f;    // Measured, for diagnostics
+    float estimatedUs = 0.0f; // Charged against budgetUs
+
+    AIScheduler() { queue.reserve(128); } // One slot per live core, so queueing never allocates
+
+    bool shouldThink(RogueCore* c, float distToPlayer, float dt);
+    void requestReplan(RogueCore* c, float distToPlayer);
+    void cancel(RogueCore* c);
+    void clear() { queue.clear(); }
+    size_t pending() const { return queue.size(); }
+    void processReplans(const Vec2& target, const std::vector<std::vector<Tile>>& map);
+
+    struct Request { RogueCore* core; float dist; };
+    const std::vector<Request>& requests() const { return queue; }
+
+private:
+    std::vector<Request> queue;
+};
+
+#endif
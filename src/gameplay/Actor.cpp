@@ -1,12 +1,14 @@
 #include "Actor.hpp"
 #include "../core/Constants.hpp"
-#include <queue>
+#include "../core/FastMath.hpp"
+#include <algorithm>
+#include <functional>
 
 namespace Graphics {
     void drawWeapon(SDL_Renderer* ren, Vec2 center, float lookAngle, int length, int width, SDL_Color col, float handOffset) {
         float handAngle = lookAngle + 1.5708f;
-        Vec2 handPos = center + Vec2(std::cos(handAngle) * handOffset, std::sin(handAngle) * handOffset);
-        float c = std::cos(lookAngle), s = std::sin(lookAngle);
+        Vec2 handPos = center + Vec2(FastMath::cos(handAngle) * handOffset, FastMath::sin(handAngle) * handOffset);
+        float c = FastMath::cos(lookAngle), s = FastMath::sin(lookAngle);
         int ex = (int)(handPos.x + c * length), ey = (int)(handPos.y + s * length);
         SDL_SetRenderDrawColor(ren, col.r, col.g, col.b, 255);
         for(int i = -width/2; i <= width/2; ++i) {
@@ -56,8 +58,8 @@ void Player::render(SDL_Renderer* ren, const Vec2& cam) {
 }
 
 // RogueCore
-RogueCore::RogueCore(Vec2 p) : Entity(p, 28, 28, EntityType::ROGUE_CORE) {}
-RogueCore::RogueCore(Vec2 p, float w, float h, EntityType t) : Entity(p, w, h, t) {}
+RogueCore::RogueCore(Vec2 p) : Entity(p, 28, 28, EntityType::ROGUE_CORE) { path.reserve(PATH_RESERVE); }
+RogueCore::RogueCore(Vec2 p, float w, float h, EntityType t) : Entity(p, w, h, t) { path.reserve(PATH_RESERVE); }
 void RogueCore::render(SDL_Renderer* ren, const Vec2& cam) {
     if (!active) return;
     SDL_Rect r = {(int)(pos.x - cam.x), (int)(pos.y - cam.y), (int)bounds.w, (int)bounds.h};
@@ -68,30 +70,39 @@ void RogueCore::render(SDL_Renderer* ren, const Vec2& cam) {
     Graphics::drawWeapon(ren, { (float)r.x + 14, (float)r.y + 14 }, lookAngle, 18, 5, {80, 40, 40, 255}, 0.0f);
     if (contained) Graphics::drawContainment(ren, r);
 }
-void RogueCore::calculatePath(const Vec2& target, const std::vector<std::vector<Tile>>& map) {
+// Open list for calculatePath as a min-heap kept across calls. Reserved up front for the worst case
+// (one push per relaxed edge) so replanning never allocates, not even on the first long search.
+// Search scratch is per thread so independent games can run side by side (tools/balance).
+typedef std::pair<float, std::pair<int,int>> PathNode;
+static thread_local std::vector<PathNode> openList = [] { std::vector<PathNode> v; v.reserve(4 * MAP_WIDTH * MAP_HEIGHT); return v; }();
+
+int RogueCore::calculatePath(const Vec2& target, const std::vector<std::vector<Tile>>& map) {
     int sx=(int)(bounds.center().x/TILE_SIZE), sy=(int)(bounds.center().y/TILE_SIZE), ex=(int)(target.x/TILE_SIZE), ey=(int)(target.y/TILE_SIZE);
-    if(sx==ex && sy==ey){path.clear(); return;}
-    if(ex<0||ex>=MAP_WIDTH||ey<0||ey>=MAP_HEIGHT||map[ey][ex].type==WALL)return;
-    static float gS[MAP_HEIGHT][MAP_WIDTH]; static std::pair<int,int> par[MAP_HEIGHT][MAP_WIDTH]; static bool vis[MAP_HEIGHT][MAP_WIDTH];
+    if(sx==ex && sy==ey){path.clear(); return 0;}
+    if(ex<0||ex>=MAP_WIDTH||ey<0||ey>=MAP_HEIGHT||map[ey][ex].type==WALL)return 0;
+    int expanded=0;
+    static thread_local float gS[MAP_HEIGHT][MAP_WIDTH]; static thread_local std::pair<int,int> par[MAP_HEIGHT][MAP_WIDTH]; static thread_local bool vis[MAP_HEIGHT][MAP_WIDTH];
     for(int y=0; y<MAP_HEIGHT; ++y) for(int x=0; x<MAP_WIDTH; ++x) { gS[y][x]=1e6f; vis[y][x]=false; }
-    std::priority_queue<std::pair<float, std::pair<int,int>>, std::vector<std::pair<float, std::pair<int,int>>>, std::greater<std::pair<float, std::pair<int,int>>>> pq;
-    gS[sy][sx]=0; pq.push({0, {sx, sy}}); bool found=false;
+    typedef PathNode Node;
+    std::vector<Node>& pq = openList; pq.clear();
+    gS[sy][sx]=0; pq.push_back({0, {sx, sy}}); bool found=false;
         while(!pq.empty()){
-            auto cur=pq.top().second; pq.pop(); int cx=cur.first, cy=cur.second; if(cx==ex && cy==ey){found=true; break;}
+            std::pop_heap(pq.begin(), pq.end(), std::greater<Node>()); auto cur=pq.back().second; pq.pop_back(); int cx=cur.first, cy=cur.second; if(cx==ex && cy==ey){found=true; break;}
             if(vis[cy][cx]) continue; 
-            vis[cy][cx]=true; 
+            vis[cy][cx]=true; expanded++;
             int dx[]={0,0,1,-1}, dy[]={1,-1,0,0};
             for(int i=0; i<4; ++i){ 
                 int nx=cx+dx[i], ny=cy+dy[i]; 
                 if(nx>=0&&nx<MAP_WIDTH&&ny>=0&&ny<MAP_HEIGHT&&map[ny][nx].type!=WALL&&!vis[ny][nx]){ 
                     float tg=gS[cy][cx]+1.0f; 
                     if(tg<gS[ny][nx]){
-                        par[ny][nx]={cx,cy}; gS[ny][nx]=tg; pq.push({tg+(float)std::abs(nx-ex)+(float)std::abs(ny-ey), {nx,ny}}); 
+                        par[ny][nx]={cx,cy}; gS[ny][nx]=tg; pq.push_back({tg+(float)std::abs(nx-ex)+(float)std::abs(ny-ey), {nx,ny}}); std::push_heap(pq.begin(), pq.end(), std::greater<Node>()); 
                     } 
                 } 
             }
         }
     path.clear(); if(found){ int cx=ex, cy=ey; while(cx!=sx||cy!=sy){ path.push_back({(float)cx*TILE_SIZE+20, (float)cy*TILE_SIZE+20}); auto p=par[cy][cx]; cx=p.first; cy=p.second; } std::reverse(path.begin(), path.end()); pathIndex=0; }
+    return expanded;
 }
 
 // Guardian
@@ -109,7 +120,7 @@ void GuardianCore::render(SDL_Renderer* ren, const Vec2& cam) {
 }
 
 // Seeker
-SeekerSwarm::SeekerSwarm(Vec2 p) : RogueCore(p, 20, 20, EntityType::ROGUE_CORE) { stability = 30.0f; angleOffset = (float)(rand() % 360); }
+SeekerSwarm::SeekerSwarm(Vec2 p) : RogueCore(p, 20, 20, EntityType::ROGUE_CORE) { stability = 30.0f; angleOffset = (float)(gameRand() % 360); }
 void SeekerSwarm::update(float dt, const std::vector<std::vector<Tile>>& map) {
     if (stunTimer <= 0) { angleOffset += 5.0f * dt; Vec2 orbit = {std::cos(angleOffset) * 40.0f, std::sin(angleOffset) * 40.0f}; move(orbit * dt, map); }
     RogueCore::update(dt, map);
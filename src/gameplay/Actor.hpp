@@ -38,13 +38,15 @@ public:
     bool sanitized = false;
     float stateTimer = 0.0f;
     float stunTimer = 0.0f;
+    float thinkTimer = 0.0f;
+    bool replanQueued = false;
     std::vector<Vec2> path;
     size_t pathIndex = 0;
 
     RogueCore(Vec2 p);
     RogueCore(Vec2 p, float w, float h, EntityType t);
     void render(SDL_Renderer* ren, const Vec2& cam) override;
-    void calculatePath(const Vec2& target, const std::vector<std::vector<Tile>>& map);
+    int calculatePath(const Vec2& target, const std::vector<std::vector<Tile>>& map); // Returns nodes expanded
 };
 
 class GuardianCore : public RogueCore {
@@ -0,0 +1,32 @@
+#ifndef CORESTATS_HPP
+#define CORESTATS_HPP
+
+#include <vector>
+#include "Actor.hpp"
+
+// Running totals over Game::cores, kept up to date at the few places a core joins or leaves the list
+// or is sanitized, so the objective, ambient and HUD read them instead of scanning every tick.
+// live: not yet sanitized; boss: the live FinalBossCore, if any.
+struct CoreStats {
+    int live = 0;
+    FinalBossCore* boss = nullptr;
+
+    void clear() { live = 0; boss = nullptr; }
+    void recount(const std::vector<RogueCore*>& cores) { clear(); for (auto c : cores) add(c); }
+
+    void add(RogueCore* c) {
+        if (c->sanitized) return;
+        live++;
+        if (auto b = dynamic_cast<FinalBossCore*>(c)) boss = b;
+    }
+    void remove(RogueCore* c) {
+        if (c->sanitized) return;
+        live--;
+        if (c == boss) boss = nullptr;
+    }
+    void sanitize(RogueCore* c) { remove(c); } // Call before setting the flag
+
+    bool allSanitized() const { return live == 0; }
+};
+
+#endif
@@ -12,14 +12,14 @@ public:
     SDL_Color color;
 
     DecorativeMachine(Vec2 p, SoundType s, SDL_Color c) : Entity(p, 32, 32, EntityType::DECORATION), sound(s), color(c) {
-        timer = (float)(rand() % 500) / 100.0f;
+        timer = (float)(gameRand() % 500) / 100.0f;
     }
 
     void update(float dt, const std::vector<std::vector<Tile>>& map) override {
         (void)map;
         timer -= dt;
         if (timer <= 0) {
-            timer = 3.0f + (float)(rand() % 400) / 100.0f;
+            timer = 3.0f + (float)(gameRand() % 400) / 100.0f;
             // Sound is played by Game
         }
     }
@@ -2,6 +2,7 @@
 #define ITEM_HPP
 
 #include "../engine/Entity.hpp"
+#include "../core/Constants.hpp"
 
 class Item : public Entity {
 public:
@@ -0,0 +1,101 @@
+#include "SectorPlan.hpp"
+#include <queue>
+#include "../core/Constants.hpp"
+#include "../core/Rect.hpp"
+
+namespace SectorGen {
+
+void generateMap(std::vector<std::vector<Tile>>& map, Rng& rng) {
+    bool connected = false;
+    while (!connected) {
+        map.assign(MAP_HEIGHT, std::vector<Tile>(MAP_WIDTH));
+        for (int y = 0; y < MAP_HEIGHT; ++y) {
+            for (int x = 0; x < MAP_WIDTH; ++x) {
+                map[y][x].type = WALL;
+                map[y][x].rect = {(float)x * TILE_SIZE, (float)y * TILE_SIZE, (float)TILE_SIZE, (float)TILE_SIZE};
+            }
+        }
+        std::vector<Rect> rooms;
+        for (int i = 0; i < 15; ++i) {
+            int w = 6 + rng.next() % 6, h = 6 + rng.next() % 6, x = 1 + rng.next() % (MAP_WIDTH - w - 1), y = 1 + rng.next() % (MAP_HEIGHT - h - 1);
+            Rect r = {(float)x, (float)y, (float)w, (float)h};
+            bool ok = true;
+            for (const auto& ex : rooms) if (r.intersects({ex.x - 1, ex.y - 1, ex.w + 2, ex.h + 2})) { ok = false; break; }
+            if (ok) {
+                rooms.push_back(r);
+                for (int ry = y; ry < y + h; ++ry) for (int rx = (int)x; rx < (int)x + w; ++rx) map[ry][rx].type = FLOOR;
+            }
+        }
+        for (size_t i = 1; i < rooms.size(); ++i) {
+            Vec2 p1 = rooms[i - 1].center(), p2 = rooms[i].center();
+            int xDir = (p2.x > p1.x) ? 1 : -1; for (int x = (int)p1.x; x != (int)p2.x; x += xDir) map[(int)p1.y][x].type = FLOOR;
+            int yDir = (p2.y > p1.y) ? 1 : -1; for (int y = (int)p1.y; y != (int)p2.y; y += yDir) map[y][(int)p2.x].type = FLOOR;
+        }
+        if (rooms.empty()) continue;
+        std::vector<std::vector<bool>> reachable(MAP_HEIGHT, std::vector<bool>(MAP_WIDTH, false));
+        std::queue<std::pair<int, int>> q; Vec2 start = rooms[0].center(); q.push({(int)start.x, (int)start.y}); reachable[(int)start.y][(int)start.x] = true;
+        while (!q.empty()) {
+            auto cur = q.front(); q.pop();
+            int dx[] = {0, 0, 1, -1}, dy[] = {1, -1, 0, 0};
+            for (int i = 0; i < 4; ++i) {
+                int nx = cur.first + dx[i], ny = cur.second + dy[i];
+                if (nx >= 0 && nx < MAP_WIDTH && ny >= 0 && ny < MAP_HEIGHT && map[ny][nx].type == FLOOR && !reachable[ny][nx]) { reachable[ny][nx] = true; q.push({nx, ny}); }
+            }
+        }
+        connected = true;
+        for (int y = 0; y < MAP_HEIGHT; ++y) for (int x = 0; x < MAP_WIDTH; ++x) if (map[y][x].type == FLOOR && !reachable[y][x]) connected = false;
+        
+        if (connected) {
+            for (int y = 0; y < MAP_HEIGHT; ++y) {
+                for (int x = 0; x < MAP_WIDTH; ++x) {
+                    if (map[y][x].type == FLOOR && rng.next() % 100 < 2) map[y][x].type = HAZARD_TILE;
+                }
+            }
+        }
+    }
+}
+
+Vec2 findSpace(const std::vector<std::vector<Tile>>& map, Rng& rng, float w, float h) {
+    for(int i = 0; i < 2000; ++i) {
+        int x = 1 + rng.next() % (MAP_WIDTH - 2);
+        int y = 1 + rng.next() % (MAP_HEIGHT - 2);
+        if (map[y][x].type == FLOOR) {
+            Rect r = {(float)x * TILE_SIZE + 2, (float)y * TILE_SIZE + 2, w, h};
+            bool safe = true;
+            for (int sy = y - 1; sy <= y + 2; sy++) {
+                for (int sx = x - 1; sx <= x + 2; sx++) {
+                    if (sx >= 0 && sx < MAP_WIDTH && sy >= 0 && sy < MAP_HEIGHT && map[sy][sx].type == WALL && r.intersects(map[sy][sx].rect)) safe = false;
+                }
+            }
+            if (safe) return {r.x, r.y};
+        }
+    }
+    return {MAP_WIDTH * TILE_SIZE / 2.0f, MAP_HEIGHT * TILE_SIZE / 2.0f};
+}
+
+void layout(SectorPlan& plan, Rng& rng) {
+    const auto& map = plan.map;
+    int sector = plan.sector;
+    plan.player = findSpace(map, rng, 24, 24);
+    plan.cores.clear(); plan.swarms.clear(); plan.items.clear(); plan.decorations.clear();
+    for (int i = 0; i < 5 + sector * 2; ++i) plan.cores.push_back(findSpace(map, rng, 28, 28));
+    if (sector % 2 == 0) {
+        for (int i = 0; i < 2 + sector / 2; ++i) plan.swarms.push_back(findSpace(map, rng, 20, 20));
+    }
+    plan.hasBoss = sector % 5 == 0;
+    if (plan.hasBoss) plan.boss = findSpace(map, rng, 80, 80);
+    for (int i = 0; i < 8; ++i) { Vec2 at = findSpace(map, rng, 20, 20); plan.items.push_back({at, (rng.next() % 100 < 40) ? ItemType::BATTERY_PACK : ItemType::REPAIR_KIT}); }
+    for (int i = 0; i < 6 + sector; ++i) {
+        SoundType st = (rng.next() % 3 == 0) ? SoundType::MACHINERY : (rng.next() % 2 == 0 ? SoundType::STEAM : SoundType::DRIP);
+        plan.decorations.push_back({findSpace(map, rng, 32, 32), st});
+    }
+    if (plan.hasExit) plan.exit = findSpace(map, rng, 40, 40);
+}
+
+void build(SectorPlan& plan) {
+    Rng rng(plan.seed);
+    generateMap(plan.map, rng);
+    layout(plan, rng);
+}
+
+}
@@ -0,0 +1,37 @@
+#ifndef SECTORPLAN_HPP
+#define SECTORPLAN_HPP
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "../core/Enums.hpp"
+#include "../core/Vec2.hpp"
+#include "../engine/AudioManager.hpp"
+
+// Layout of one sector: the map plus every spawn point Game::startSector() needs. It is built
+// from its own Rng and touches no game state, so the next sector can be planned on a worker
+// while the summary screen is up and swapped in on confirm.
+struct SectorPlan {
+    int sector = -1;
+    uint64_t seed = 0;
+    bool hasExit = true;
+    std::vector<std::vector<Tile>> map;
+    Vec2 player, exit, boss;
+    bool hasBoss = false;
+    std::vector<Vec2> cores, swarms;
+    std::vector<std::pair<Vec2, ItemType>> items;
+    std::vector<std::pair<Vec2, SoundType>> decorations;
+};
+
+namespace SectorGen {
+
+void generateMap(std::vector<std::vector<Tile>>& map, Rng& rng);
+Vec2 findSpace(const std::vector<std::vector<Tile>>& map, Rng& rng, float w, float h);
+// Places spawns for plan.sector on plan.map, which must already be filled
+void layout(SectorPlan& plan, Rng& rng);
+// generateMap + layout, drawing only from Rng(plan.seed)
+void build(SectorPlan& plan);
+
+}
+
+#endif
@@ -0,0 +1,148 @@
+#include "Serialize.hpp"
+#include "../core/Constants.hpp"
+
+namespace Serialize {
+
+void writeMap(Snapshot::Writer& w, const std::vector<std::vector<Tile>>& map) {
+    uint32_t h = (uint32_t)map.size(), wd = h ? (uint32_t)map[0].size() : 0;
+    w.put(wd); w.put(h);
+    size_t at = w.buf.size();
+    w.buf.resize(at + (size_t)wd * h);
+    uint8_t* out = w.buf.data() + at;
+    for (uint32_t y = 0; y < h; ++y) for (uint32_t x = 0; x < wd; ++x) *out++ = (uint8_t)map[y][x].type;
+}
+
+bool readMap(Snapshot::Reader& r, std::vector<std::vector<Tile>>& map, uint32_t width, uint32_t height) {
+    uint32_t wd = r.get<uint32_t>(), h = r.get<uint32_t>();
+    if (wd != width || h != height) { r.ok = false; return false; }
+    const uint8_t* types = r.view((size_t)wd * h);
+    if (!types) return false;
+    for (size_t i = 0; i < (size_t)wd * h; ++i) if (types[i] > HAZARD_TILE) { r.ok = false; return false; }
+    map.assign(h, std::vector<Tile>(wd));
+    for (uint32_t y = 0; y < h; ++y) {
+        for (uint32_t x = 0; x < wd; ++x) {
+            map[y][x].type = (TileType)*types++;
+            map[y][x].rect = {(float)x * TILE_SIZE, (float)y * TILE_SIZE, (float)TILE_SIZE, (float)TILE_SIZE};
+        }
+    }
+    return true;
+}
+
+void writeEntity(Snapshot::Writer& w, const Entity& e) {
+    w.put(e.pos); w.put(e.vel); w.put(e.bounds); w.put((uint8_t)e.active); w.put(e.lookAngle);
+}
+
+void readEntity(Snapshot::Reader& r, Entity& e) {
+    e.pos = r.get<Vec2>(); e.vel = r.get<Vec2>(); e.bounds = r.get<Rect>();
+    e.active = r.get<uint8_t>() != 0; e.lookAngle = r.get<float>();
+}
+
+void writePlayer(Snapshot::Writer& w, const Player& p) {
+    writeEntity(w, p);
+    w.put(p.suitIntegrity); w.put(p.shield); w.put(p.maxShield); w.put(p.prevShield); w.put(p.energy); w.put(p.reflexMeter);
+    w.put(p.slugs); w.put(p.maxSlugs); w.put(p.reserveSlugs); w.put(p.dashTimer); w.put(p.stepTimer);
+    w.put((uint8_t)p.reflexActive); w.put(p.shootCooldown);
+}
+
+Player* readPlayer(Snapshot::Reader& r, Arena& arena) {
+    Player* p = arena.make<Player>(Vec2{0, 0});
+    readEntity(r, *p);
+    p->suitIntegrity = r.get<float>(); p->shield = r.get<float>(); p->maxShield = r.get<float>(); p->prevShield = r.get<float>();
+    p->energy = r.get<float>(); p->reflexMeter = r.get<float>();
+    p->slugs = r.get<int>(); p->maxSlugs = r.get<int>(); p->reserveSlugs = r.get<int>();
+    p->dashTimer = r.get<float>(); p->stepTimer = r.get<float>();
+    p->reflexActive = r.get<uint8_t>() != 0; p->shootCooldown = r.get<float>();
+    return p;
+}
+
+void writeCore(Snapshot::Writer& w, const RogueCore* c, const std::vector<RogueCore*>& cores) {
+    const GuardianCore* g = dynamic_cast<const GuardianCore*>(c);
+    const SeekerSwarm* sw = dynamic_cast<const SeekerSwarm*>(c);
+    const RepairDrone* dr = dynamic_cast<const RepairDrone*>(c);
+    const FinalBossCore* bs = dynamic_cast<const FinalBossCore*>(c);
+    w.put((uint8_t)(g ? CORE_GUARDIAN : sw ? CORE_SEEKER : dr ? CORE_DRONE : bs ? CORE_BOSS : CORE_ROGUE));
+    writeEntity(w, *c);
+    w.put(c->stability); w.put((uint8_t)c->contained); w.put((uint8_t)c->sanitized);
+    w.put(c->stateTimer); w.put(c->stunTimer); w.put(c->thinkTimer); w.put((uint8_t)c->replanQueued);
+    w.putArray(c->path); w.put((uint32_t)c->pathIndex);
+    if (g) w.put(g->shield);
+    if (sw) w.put(sw->angleOffset);
+    if (dr) {
+        int idx = -1;
+        for (size_t i = 0; i < cores.size(); ++i) if (cores[i] == dr->target) { idx = (int)i; break; }
+        w.put(dr->repairPower); w.put(idx);
+    }
+    if (bs) { w.put(bs->phase); w.put(bs->phaseTimer); }
+}
+
+RogueCore* readCore(Snapshot::Reader& r, Arena& arena, int& targetIndex) {
+    targetIndex = -1;
+    uint8_t kind = r.get<uint8_t>();
+    if (kind > CORE_BOSS) r.ok = false;
+    RogueCore* c;
+    switch (kind) {
+        case CORE_GUARDIAN: c = arena.make<GuardianCore>(Vec2{0, 0}); break;
+        case CORE_SEEKER: c = arena.make<SeekerSwarm>(Vec2{0, 0}); break;
+        case CORE_DRONE: c = arena.make<RepairDrone>(Vec2{0, 0}); break;
+        case CORE_BOSS: c = arena.make<FinalBossCore>(Vec2{0, 0}); break;
+        default: c = arena.make<RogueCore>(Vec2{0, 0}); break;
+    }
+    readEntity(r, *c);
+    c->stability = r.get<float>(); c->contained = r.get<uint8_t>() != 0; c->sanitized = r.get<uint8_t>() != 0;
+    c->stateTimer = r.get<float>(); c->stunTimer = r.get<float>(); c->thinkTimer = r.get<float>(); c->replanQueued = r.get<uint8_t>() != 0;
+    r.getArray(c->path); c->pathIndex = r.get<uint32_t>();
+    if (kind == CORE_GUARDIAN) ((GuardianCore*)c)->shield = r.get<float>();
+    if (kind == CORE_SEEKER) ((SeekerSwarm*)c)->angleOffset = r.get<float>();
+    if (kind == CORE_DRONE) { ((RepairDrone*)c)->repairPower = r.get<float>(); targetIndex = r.get<int>(); }
+    if (kind == CORE_BOSS) { ((FinalBossCore*)c)->phase = r.get<int>(); ((FinalBossCore*)c)->phaseTimer = r.get<float>(); }
+    return c;
+}
+
+void linkCores(std::vector<RogueCore*>& cores, const std::vector<int>& targetIndices) {
+    for (size_t i = 0; i < cores.size() && i < targetIndices.size(); ++i) {
+        RepairDrone* dr = dynamic_cast<RepairDrone*>(cores[i]);
+        int t = targetIndices[i];
+        if (dr) dr->target = (t >= 0 && t < (int)cores.size()) ? cores[t] : nullptr;
+    }
+}
+
+void writeSlug(Snapshot::Writer& w, const KineticSlug& s) {
+    writeEntity(w, s);
+    w.put(s.bounces); w.put(s.powerMultiplier); w.put((uint8_t)s.isPlayer); w.put(s.ammoType);
+    w.put((uint32_t)s.tail.size()); for (int i = 0; i < s.tail.size(); ++i) w.put(s.tail[i]);
+}
+
+KineticSlug* readSlug(Snapshot::Reader& r, Arena& arena) {
+    KineticSlug* s = arena.make<KineticSlug>(Vec2{0, 0}, Vec2{0, 0}, false);
+    readEntity(r, *s);
+    s->bounces = r.get<int>(); s->powerMultiplier = r.get<float>(); s->isPlayer = r.get<uint8_t>() != 0;
+    s->ammoType = r.getEnum(AmmoType::PIERCING);
+    uint32_t n = r.get<uint32_t>(); for (uint32_t i = 0; i < n && r.ok; ++i) s->tail.push(r.get<Vec2>());
+    return s;
+}
+
+void writeItem(Snapshot::Writer& w, const Item& i) { writeEntity(w, i); w.put(i.it); }
+
+Item* readItem(Snapshot::Reader& r, Arena& arena) {
+    Item* i = arena.make<Item>(Vec2{0, 0}, ItemType::REPAIR_KIT);
+    readEntity(r, *i); i->it = r.getEnum(ItemType::OVERCLOCK);
+    return i;
+}
+
+void writeEcho(Snapshot::Writer& w, const NeuralEcho& e) { writeEntity(w, e); w.put(e.life); }
+
+NeuralEcho* readEcho(Snapshot::Reader& r, Arena& arena) {
+    NeuralEcho* e = arena.make<NeuralEcho>(Vec2{0, 0});
+    readEntity(r, *e); e->life = r.get<float>();
+    return e;
+}
+
+void writeDecoration(Snapshot::Writer& w, const DecorativeMachine& d) { writeEntity(w, d); w.put(d.sound); w.put(d.timer); w.put(d.color); }
+
+DecorativeMachine* readDecoration(Snapshot::Reader& r, Arena& arena) {
+    DecorativeMachine* d = arena.make<DecorativeMachine>(Vec2{0, 0}, SoundType::DRIP, SDL_Color{0, 0, 0, 0});
+    readEntity(r, *d); d->sound = r.getEnum((SoundType)((int)SoundType::COUNT - 1)); d->timer = r.get<float>(); d->color = r.get<SDL_Color>();
+    return d;
+}
+
+}
@@ -0,0 +1,45 @@
+#ifndef SERIALIZE_HPP
+#define SERIALIZE_HPP
+
+#include <vector>
+#include "../engine/Snapshot.hpp"
+#include "../engine/Arena.hpp"
+#include "Actor.hpp"
+#include "Slug.hpp"
+#include "Item.hpp"
+#include "Environmental.hpp"
+#include "../core/Constants.hpp"
+
+// Per-type snapshot encoders. Readers allocate fresh objects from the given arena.
+namespace Serialize {
+
+enum CoreKind : uint8_t { CORE_ROGUE, CORE_GUARDIAN, CORE_SEEKER, CORE_DRONE, CORE_BOSS };
+const size_t ENTITY_BYTES = 2 * sizeof(Vec2) + sizeof(Rect) + 1 + sizeof(float); // Smallest record of any entity type
+
+void writeMap(Snapshot::Writer& w, const std::vector<std::vector<Tile>>& map);
+// Rejects (and latches r.ok = false) any map not exactly width x height, or with unknown tile types
+bool readMap(Snapshot::Reader& r, std::vector<std::vector<Tile>>& map, uint32_t width = MAP_WIDTH, uint32_t height = MAP_HEIGHT);
+
+void writeEntity(Snapshot::Writer& w, const Entity& e);
+void readEntity(Snapshot::Reader& r, Entity& e);
+
+void writePlayer(Snapshot::Writer& w, const Player& p);
+Player* readPlayer(Snapshot::Reader& r, Arena& arena);
+
+// Repair drone targets are stored as indices into `cores`, resolved by linkCores()
+void writeCore(Snapshot::Writer& w, const RogueCore* c, const std::vector<RogueCore*>& cores);
+RogueCore* readCore(Snapshot::Reader& r, Arena& arena, int& targetIndex);
+void linkCores(std::vector<RogueCore*>& cores, const std::vector<int>& targetIndices);
+
+void writeSlug(Snapshot::Writer& w, const KineticSlug& s);
+KineticSlug* readSlug(Snapshot::Reader& r, Arena& arena);
+void writeItem(Snapshot::Writer& w, const Item& i);
+Item* readItem(Snapshot::Reader& r, Arena& arena);
+void writeEcho(Snapshot::Writer& w, const NeuralEcho& e);
+NeuralEcho* readEcho(Snapshot::Reader& r, Arena& arena);
+void writeDecoration(Snapshot::Writer& w, const DecorativeMachine& d);
+DecorativeMachine* readDecoration(Snapshot::Reader& r, Arena& arena);
+
+}
+
+#endif
@@ -1,5 +1,6 @@
 #include "Slug.hpp"
 #include "../core/Constants.hpp"
+#include "../engine/Collision.hpp"
 
 KineticSlug::KineticSlug(Vec2 p, Vec2 v, bool pOwned, AmmoType at)
     : Entity(p, 6, 6, EntityType::KINETIC_SLUG), isPlayer(pOwned), ammoType(at) {
@@ -7,39 +8,25 @@ KineticSlug::KineticSlug(Vec2 p, Vec2 v, bool pOwned, AmmoType at)
 }
 
 void KineticSlug::update(float dt, const std::vector<std::vector<Tile>>& map) {
-    tail.push_back(pos);
-    if (tail.size() > 12) tail.erase(tail.begin());
+    tail.push(pos);
 
-    Vec2 delta = vel * dt;
-    float dist = delta.length();
-    int steps = (int)(dist / 4.0f) + 1;
-    Vec2 step = delta / (float)steps;
-
-    for (int i = 0; i < steps; ++i) {
-        pos.x += step.x;
-        if (checkWall(map)) {
-            pos.x -= step.x;
-            vel.x *= -1;
-            handleBounce();
-        }
-        pos.y += step.y;
-        if (checkWall(map)) {
-            pos.y -= step.y;
-            vel.y *= -1;
-            handleBounce();
-        }
+    // Reflect off every wall reached this tick; bounce count, not speed, bounds the loop
+    Vec2 delta = vel * (dt - spawnDelay);
+    spawnDelay = 0.0f;
+    for (int i = 0; i < 8 && active && (delta.x != 0 || delta.y != 0); ++i) {
+        SweepHit hit = sweepAABB({pos.x, pos.y, bounds.w, bounds.h}, delta, map);
+        pos = pos + delta * hit.t;
+        if (!hit.hit) break;
+        delta = delta * (1.0f - hit.t);
+        if (hit.nx) { pos.x += hit.nx * 0.001f; vel.x *= -1; delta.x *= -1; }
+        else { pos.y += hit.ny * 0.001f; vel.y *= -1; delta.y *= -1; }
+        handleBounce();
     }
     bounds.x = pos.x;
     bounds.y = pos.y;
     if (pos.x < 0 || pos.y < 0 || pos.x > MAP_WIDTH * TILE_SIZE || pos.y > MAP_HEIGHT * TILE_SIZE) active = false;
 }
 
-bool KineticSlug::checkWall(const std::vector<std::vector<Tile>>& map) {
-    int bx = (int)(pos.x / TILE_SIZE);
-    int by = (int)(pos.y / TILE_SIZE);
-    return (bx >= 0 && bx < MAP_WIDTH && by >= 0 && by < MAP_HEIGHT && map[by][bx].type == WALL);
-}
-
 void KineticSlug::handleBounce() {
     bounces--;
     powerMultiplier += 0.65f;
@@ -49,7 +36,7 @@ void KineticSlug::handleBounce() {
 void KineticSlug::render(SDL_Renderer* ren, const Vec2& camera) {
     if (!active) return;
     SDL_Color trailCol = isPlayer ? (ammoType == AmmoType::EMP ? COL_EMP : (ammoType == AmmoType::PIERCING ? COL_GOLD : COL_PLAYER)) : COL_ROGUE_SLUG;
-    for (size_t i = 0; i < tail.size(); ++i) {
+    for (int i = 0; i < tail.size(); ++i) {
         SDL_SetRenderDrawColor(ren, trailCol.r, trailCol.g, trailCol.b, (Uint8)(60 * (i / (float)tail.size())));
         SDL_Rect tr = {(int)(tail[i].x - camera.x), (int)(tail[i].y - camera.y), 4, 4};
         SDL_RenderFillRect(ren, &tr);
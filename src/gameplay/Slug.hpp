@@ -2,6 +2,7 @@
 #define SLUG_HPP
 
 #include "../engine/Entity.hpp"
+#include "../core/SmallString.hpp"
 #include <vector>
 
 class KineticSlug : public Entity {
@@ -9,12 +10,12 @@ public:
     int bounces = 4;
     float powerMultiplier = 1.0f;
     bool isPlayer;
-    std::vector<Vec2> tail;
+    FixedRing<Vec2, 12> tail;
     AmmoType ammoType = AmmoType::STANDARD;
+    float spawnDelay = 0.0f; // Part of the first tick that passed before the shot was fired
 
     KineticSlug(Vec2 p, Vec2 v, bool pOwned, AmmoType at = AmmoType::STANDARD);
     void update(float dt, const std::vector<std::vector<Tile>>& map) override;
-    bool checkWall(const std::vector<std::vector<Tile>>& map);
     void handleBounce();
     void render(SDL_Renderer* ren, const Vec2& camera) override;
 };
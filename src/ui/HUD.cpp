@@ -1,39 +1,31 @@
 #include "HUD.hpp"
 #include "../Game.hpp"
+#include "../engine/Profiler.hpp"
 #include <algorithm>
+#include <cstdio>
 
-void HUD::addLog(const std::string& m, SDL_Color c) {
-    logs.push_back({m, 5.0f, c});
-    if (logs.size() > 6) logs.erase(logs.begin());
+void HUD::addLog(const char* m, SDL_Color c) {
+    LogEntry e;
+    e.line.format("> %s", m); e.life = 5.0f; e.col = c;
+    logs.push(e);
 }
 
 void HUD::update(float dt) {
-    for (auto& l : logs) l.life -= dt;
-    logs.erase(std::remove_if(logs.begin(), logs.end(), [](const LogEntry& le) { return le.life <= 0; }), logs.end());
+    for (int i = 0; i < logs.size(); ++i) logs[i].life -= dt;
+    // Every entry starts with the same life, so they expire oldest-first
+    while (!logs.empty() && logs.front().life <= 0) logs.popFront();
 }
 
-void HUD::renderText(SDL_Renderer* ren, const std::string& t, int x, int y, TTF_Font* f, SDL_Color c) {
-    if (!f || t.empty()) return;
-    
-    // Bloom shadow
-    SDL_Color bloom = c; bloom.a = 60;
-    SDL_Surface* bs = TTF_RenderText_Blended(f, t.c_str(), bloom);
-    if (bs) {
-        SDL_Texture* bt = SDL_CreateTextureFromSurface(ren, bs);
-        SDL_Rect bd = {x - 1, y - 1, bs->w + 2, bs->h + 2};
-        SDL_SetRenderDrawBlendMode(ren, SDL_BLENDMODE_BLEND);
-        SDL_RenderCopy(ren, bt, NULL, &bd);
-        SDL_DestroyTexture(bt); SDL_FreeSurface(bs);
-    }
+const char* HUD::Label::set(const char* fmt, int x, int y) {
+    if (x != a || y != b || text.empty()) { text.format(fmt, x, y); a = x; b = y; }
+    return text.c_str();
+}
 
-    SDL_Surface* s = TTF_RenderText_Blended(f, t.c_str(), c);
-    if (s) {
-        SDL_Texture* tx = SDL_CreateTextureFromSurface(ren, s);
-        SDL_Rect dst = {x, y, s->w, s->h};
-        SDL_RenderCopy(ren, tx, NULL, &dst);
-        SDL_DestroyTexture(tx);
-        SDL_FreeSurface(s);
-    }
+void HUD::renderText(SDL_Renderer* ren, const char* t, int x, int y, TTF_Font* f, SDL_Color c) {
+    if (!f || !t[0]) return;
+    SDL_Color bloom = c; bloom.a = 60;
+    text.draw(ren, f, t, x, y, bloom, 1);
+    text.draw(ren, f, t, x, y, c);
 }
 
 void HUD::renderMenu(SDL_Renderer* ren, TTF_Font* font, TTF_Font* fontL) {
@@ -73,20 +65,20 @@ void HUD::drawBar(SDL_Renderer* ren, int x, int y, int w, int h, float pct, SDL_
 }
 
 void HUD::renderSummary(SDL_Renderer* ren, int score, int sector, TTF_Font* font, TTF_Font* fontL) {
-    renderText(ren, "SECTOR " + std::to_string(sector) + " CLEARED", SCREEN_WIDTH / 2 - 200, 100, fontL, {50, 150, 255, 255});
+    renderText(ren, summarySector.set("SECTOR %d CLEARED", sector), SCREEN_WIDTH / 2 - 200, 100, fontL, {50, 150, 255, 255});
     renderText(ren, "STATUS: CORE SANITIZATION COMPLETE", SCREEN_WIDTH / 2 - 140, 170, font, {200, 200, 255, 255});
     
     SDL_SetRenderDrawColor(ren, 50, 60, 80, 255);
     SDL_Rect line = {SCREEN_WIDTH / 2 - 200, 210, 400, 2};
     SDL_RenderFillRect(ren, &line);
 
-    renderText(ren, "FINANCIAL ASSETS RECOVERED: " + std::to_string(score), SCREEN_WIDTH / 2 - 120, 240, font, {255, 255, 255, 255});
+    renderText(ren, summaryScore.set("FINANCIAL ASSETS RECOVERED: %d", score), SCREEN_WIDTH / 2 - 120, 240, font, {255, 255, 255, 255});
     renderText(ren, "SECTOR PERFORMANCE RATING: S-CLASS", SCREEN_WIDTH / 2 - 140, 270, font, {255, 255, 100, 255});
     
     renderText(ren, "MISSION LOG HISTORY:", SCREEN_WIDTH / 2 - 80, 330, font, {150, 150, 150, 255});
     int sy = 360;
-    for (const auto& l : logs) {
-        renderText(ren, l.msg, SCREEN_WIDTH / 2 - 150, sy, font, {100, 100, 150, 255});
+    for (int i = 0; i < logs.size(); ++i) {
+        renderText(ren, logs[i].msg(), SCREEN_WIDTH / 2 - 150, sy, font, {100, 100, 150, 255});
         sy += 20;
     }
     
@@ -108,33 +100,30 @@ void HUD::render(SDL_Renderer* ren, Player* p, int score, int sector, Game& game
     drawBar(ren, 20, 65, 150, 10, p->reflexMeter / 100.0f, {255, 200, 50, 255});
     renderText(ren, "REFLEX", 25, 65, font, {255, 255, 200, 255});
     
-    renderText(ren, "SLUGS: " + std::to_string(p->slugs) + " / " + std::to_string(p->reserveSlugs), 20, 85, font, {220, 220, 220, 255});
-    std::string ammoStr = (game.currentAmmo == AmmoType::STANDARD) ? "STANDARD" : (game.currentAmmo == AmmoType::EMP) ? "EMP" : "PIERCING";
-    renderText(ren, "AMMO: " + ammoStr, 20, 100, font, {150, 255, 255, 255});
+    renderText(ren, slugLabel.set("SLUGS: %d / %d", p->slugs, p->reserveSlugs), 20, 85, font, {220, 220, 220, 255});
+    const char* ammoStr = (game.currentAmmo == AmmoType::STANDARD) ? "AMMO: STANDARD" : (game.currentAmmo == AmmoType::EMP) ? "AMMO: EMP" : "AMMO: PIERCING";
+    renderText(ren, ammoStr, 20, 100, font, {150, 255, 255, 255});
     
-    renderText(ren, "SECTOR: " + std::to_string(sector), SCREEN_WIDTH-120, 40, font, {150, 150, 255, 255});
-    renderText(ren, "SCORE: " + std::to_string(score), SCREEN_WIDTH-120, 60, font, {255, 255, 255, 255});
+    renderText(ren, sectorLabel.set("SECTOR: %d", sector), SCREEN_WIDTH-120, 40, font, {150, 150, 255, 255});
+    renderText(ren, scoreLabel.set("SCORE: %d", score), SCREEN_WIDTH-120, 60, font, {255, 255, 255, 255});
     
     if (game.multiplier > 1.0f) {
-        std::string mStr = "MULT: x" + std::to_string(game.multiplier).substr(0, 3);
-        renderText(ren, mStr, SCREEN_WIDTH - 120, 80, font, {255, 200, 50, (Uint8)(150 + 105 * (game.multiplierTimer / 3.0f))});
+        int tenths = (int)(game.multiplier * 10.0f);
+        renderText(ren, multLabel.set("MULT: x%d.%d", tenths / 10, tenths % 10), SCREEN_WIDTH - 120, 80, font, {255, 200, 50, (Uint8)(150 + 105 * (game.multiplierTimer / 3.0f))});
     }
 
     renderText(ren, game.objective.getDesc(), SCREEN_WIDTH/2-150, 20, font, {255, 255, 100, 255});
 
-    for (auto c : game.cores) {
-        if (dynamic_cast<FinalBossCore*>(c) && !c->sanitized) {
-            FinalBossCore* bc = dynamic_cast<FinalBossCore*>(c);
-            drawBar(ren, SCREEN_WIDTH / 2 - 200, SCREEN_HEIGHT - 40, 400, 12, bc->stability / 2500.0f, {255, 50, 50, 255});
-            renderText(ren, "BOSS ANOMALY STABILITY", SCREEN_WIDTH / 2 - 80, SCREEN_HEIGHT - 38, font, {255, 255, 255, 200});
-            break;
-        }
+    if (game.coreStats.boss) {
+        drawBar(ren, SCREEN_WIDTH / 2 - 200, SCREEN_HEIGHT - 40, 400, 12, game.coreStats.boss->stability / 2500.0f, {255, 50, 50, 255});
+        renderText(ren, "BOSS ANOMALY STABILITY", SCREEN_WIDTH / 2 - 80, SCREEN_HEIGHT - 38, font, {255, 255, 255, 200});
     }
     
     // Minimap
     SDL_Rect mmRect = {SCREEN_WIDTH - 110, 100, 100, 100}; SDL_SetRenderDrawColor(ren, 0, 0, 0, 180); SDL_RenderFillRect(ren, &mmRect);
     float mapScale = 0.04f; Vec2 mapCtr = {(float)mmRect.x + 50, (float)mmRect.y + 50};
-    for(auto c : game.cores) {
+    // One O(N) pass over cores per frame: coreProx indices are stale by render time (resolveAI adds and erases cores after it is built).
+    if (game.coreStats.live) for(auto c : game.cores) {
         if(!c->sanitized) {
             Vec2 rel = (c->pos - p->pos) * mapScale;
             if(std::abs(rel.x)<48 && std::abs(rel.y)<48) {
@@ -160,5 +149,48 @@ void HUD::render(SDL_Renderer* ren, Player* p, int score, int sector, Game& game
         SDL_SetRenderDrawColor(ren, 100, 255, 100, 255); SDL_RenderFillRect(ren, &arrow);
     }
 
-    int logY = SCREEN_HEIGHT - 120; for (auto& l : logs) { renderText(ren, "> " + l.msg, 20, logY, font, l.col); logY += 18; }
+    int logY = SCREEN_HEIGHT - 120; for (int i = 0; i < logs.size(); ++i) { renderText(ren, logs[i].line.c_str(), 20, logY, font, logs[i].col); logY += 18; }
+}
+
+// Frame-time graph (last HISTORY frames against the 60 Hz budget) and per-zone mean/p99.
+void HUD::renderProfiler(SDL_Renderer* ren, TTF_Font* font, const FramePacer& pacer) {
+    Profiler& prof = Profiler::get();
+    int frameZone = prof.zone("frame"), zones = prof.zoneCount(), rows = zones;
+#ifdef RECOIL_TRACK_ALLOCS
+    rows++; // Allocations outside any zone
+#endif
+    const int gx = 20, gy = 130, gh = 60;
+    const float usPerPx = 2.0f * FRAME_DELAY * 1000.0f / gh;
+    SDL_SetRenderDrawBlendMode(ren, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderDrawColor(ren, 0, 0, 0, 180);
+    SDL_Rect bg = {gx - 5, gy - 5, Profiler::HISTORY + 10, gh + 36 + rows * 16};
+    SDL_RenderFillRect(ren, &bg);
+    for (int i = 0; i < prof.framesRecorded(); ++i) {
+        float us = prof.frameUs(frameZone, i);
+        int h = std::min(gh, (int)(us / usPerPx));
+        if (us > FRAME_DELAY * 1000.0f) SDL_SetRenderDrawColor(ren, 255, 80, 80, 255); else SDL_SetRenderDrawColor(ren, 80, 200, 120, 255);
+        SDL_RenderDrawLine(ren, gx + Profiler::HISTORY - 1 - i, gy + gh, gx + Profiler::HISTORY - 1 - i, gy + gh - h);
+    }
+    SDL_SetRenderDrawColor(ren, 255, 255, 100, 200);
+    SDL_RenderDrawLine(ren, gx, gy + gh / 2, gx + Profiler::HISTORY, gy + gh / 2);
+    SDL_SetRenderDrawBlendMode(ren, SDL_BLENDMODE_NONE);
+    char line[96];
+    for (int z = 0; z < zones; ++z) {
+        Profiler::Stats st = prof.stats(z);
+#ifdef RECOIL_TRACK_ALLOCS
+        Profiler::AllocStats a = prof.allocs(z);
+        snprintf(line, sizeof(line), "%-16s %6.2f %6.2f ms %4u allocs %7.1f KB", prof.zoneName(z), st.meanUs / 1000.0f, st.p99Us / 1000.0f, a.count, a.bytes / 1024.0f);
+#else
+        snprintf(line, sizeof(line), "%-16s %6.2f %6.2f ms", prof.zoneName(z), st.meanUs / 1000.0f, st.p99Us / 1000.0f);
+#endif
+        renderText(ren, line, gx, gy + gh + 8 + z * 16, font, {200, 230, 255, 255});
+    }
+#ifdef RECOIL_TRACK_ALLOCS
+    Profiler::AllocStats a = prof.allocs(Profiler::UNTAGGED);
+    snprintf(line, sizeof(line), "%-33s %4u allocs %7.1f KB", "(untagged)", a.count, a.bytes / 1024.0f);
+    renderText(ren, line, gx, gy + gh + 8 + zones * 16, font, {200, 230, 255, 255});
+#endif
+    FramePacer::Jitter j = pacer.jitter();
+    snprintf(line, sizeof(line), "interval %.2f ms, jitter %.2f ms, p99 %.2f ms", j.meanMs, j.stdDevMs, j.p99Ms);
+    renderText(ren, line, gx, gy + gh + 8 + rows * 16, font, {255, 255, 150, 255});
 }
@@ -6,22 +6,39 @@
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_ttf.h>
 #include "../gameplay/Actor.hpp"
+#include "../engine/FramePacer.hpp"
+#include "../core/SmallString.hpp"
+#include "TextCache.hpp"
 
 class Game;
 
 class HUD {
 public:
-    struct LogEntry { std::string msg; float life; SDL_Color col; };
-    std::vector<LogEntry> logs;
+    struct LogEntry {
+        SmallString<96> line; // "> " + message
+        float life;
+        SDL_Color col;
+        const char* msg() const { return line.c_str() + 2; }
+    };
+    // Text formatted only when the values it shows change
+    struct Label {
+        SmallString<48> text;
+        int a = 0, b = 0;
+        const char* set(const char* fmt, int x, int y = 0);
+    };
+    FixedRing<LogEntry, 6> logs;
+    TextCache text;
 
-    void addLog(const std::string& m, SDL_Color c = {200, 200, 255, 255});
+    void addLog(const char* m, SDL_Color c = {200, 200, 255, 255});
     void update(float dt);
     void render(SDL_Renderer* ren, Player* p, int score, int sector, Game& game, TTF_Font* font, TTF_Font* fontL);
     void renderMenu(SDL_Renderer* ren, TTF_Font* font, TTF_Font* fontL);
     void renderSummary(SDL_Renderer* ren, int score, int sector, TTF_Font* font, TTF_Font* fontL);
-    void renderText(SDL_Renderer* ren, const std::string& t, int x, int y, TTF_Font* f, SDL_Color c);
+    void renderText(SDL_Renderer* ren, const char* t, int x, int y, TTF_Font* f, SDL_Color c);
+    void renderProfiler(SDL_Renderer* ren, TTF_Font* font, const FramePacer& pacer);
 
 private:
+    Label slugLabel, sectorLabel, scoreLabel, multLabel, summarySector, summaryScore;
     void drawBar(SDL_Renderer* ren, int x, int y, int w, int h, float pct, SDL_Color col);
 };
 
@@ -0,0 +1,48 @@
+#include "TextCache.hpp"
+
+static uint32_t hashText(TTF_Font* font, const char* s) {
+    uint32_t h = 2166136261u ^ (uint32_t)(uintptr_t)font;
+    for (; *s; ++s) { h ^= (uint8_t)*s; h *= 16777619u; }
+    return h;
+}
+
+SDL_Texture* TextCache::get(SDL_Renderer* ren, TTF_Font* font, const char* text, int& w, int& h) {
+    w = h = 0;
+    if (!font || !text[0]) return nullptr;
+    SmallString<MAX_LEN> clipped;
+    if (strlen(text) >= MAX_LEN) { clipped.assign(text); text = clipped.c_str(); } // Cache keys are fixed-size: longer text is cut, not dropped
+    Entry* set = entries[hashText(font, text) % SETS];
+    Entry* victim = &set[0];
+    for (int i = 0; i < WAYS; ++i) {
+        Entry& e = set[i];
+        if (e.tex && e.font == font && e.text == text) { e.lastUsed = frame; w = e.w; h = e.h; return e.tex; }
+        if (!e.tex) victim = &e;
+        else if (victim->tex && e.lastUsed < victim->lastUsed) victim = &e;
+    }
+    misses++;
+    SDL_Surface* s = TTF_RenderText_Blended(font, text, {255, 255, 255, 255});
+    if (!s) return nullptr;
+    if (victim->tex) SDL_DestroyTexture(victim->tex);
+    victim->tex = SDL_CreateTextureFromSurface(ren, s);
+    victim->font = font; victim->text.assign(text); victim->w = s->w; victim->h = s->h; victim->lastUsed = frame;
+    SDL_FreeSurface(s);
+    if (!victim->tex) return nullptr;
+    SDL_SetTextureBlendMode(victim->tex, SDL_BLENDMODE_BLEND);
+    w = victim->w; h = victim->h;
+    return victim->tex;
+}
+
+void TextCache::draw(SDL_Renderer* ren, TTF_Font* font, const char* text, int x, int y, SDL_Color c, int grow) {
+    int w, h;
+    SDL_Texture* tex = get(ren, font, text, w, h);
+    if (!tex) return;
+    draws++;
+    SDL_SetTextureColorMod(tex, c.r, c.g, c.b);
+    SDL_SetTextureAlphaMod(tex, c.a);
+    SDL_Rect dst = {x - grow, y - grow, w + 2 * grow, h + 2 * grow};
+    SDL_RenderCopy(ren, tex, NULL, &dst);
+}
+
+void TextCache::clear() {
+    for (auto& set : entries) for (auto& e : set) { if (e.tex) SDL_DestroyTexture(e.tex); e = Entry(); }
+}
@@ -0,0 +1,36 @@
+#ifndef TEXTCACHE_HPP
+#define TEXTCACHE_HPP
+
+#include <cstdint>
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+#include "../core/SmallString.hpp"
+
+// Rendered-text textures kept across frames. Glyphs are rasterized once in white and tinted
+// with color/alpha mod at draw time, so one texture serves every color of the same string.
+// 4-way set-associative with LRU replacement: the set of live textures is bounded.
+class TextCache {
+public:
+    ~TextCache() { clear(); }
+    // Returns nullptr (and w = h = 0) if the font is missing or rasterizing fails. Text is cut to MAX_LEN - 1 chars.
+    SDL_Texture* get(SDL_Renderer* ren, TTF_Font* font, const char* text, int& w, int& h);
+    void draw(SDL_Renderer* ren, TTF_Font* font, const char* text, int x, int y, SDL_Color c, int grow = 0);
+    void endFrame() { frame++; }
+    void clear();
+    int misses = 0, draws = 0;
+
+private:
+    static const int MAX_LEN = 96;
+    static const int WAYS = 4, SETS = 64;
+    struct Entry {
+        TTF_Font* font = nullptr;
+        SmallString<MAX_LEN> text;
+        SDL_Texture* tex = nullptr;
+        int w = 0, h = 0;
+        uint32_t lastUsed = 0;
+    };
+    Entry entries[SETS][WAYS];
+    uint32_t frame = 1;
+};
+
+#endif
@@ -0,0 +1,188 @@
+// Monte-Carlo balancing: plays thousands of seeded sectors headless with a scripted bot, one game per
+// job across all cores, and writes per-sector aggregates as CSV. Build with `make balance`, run
+// ./balance [--runs N] [--sectors A-B] [--threads T] [--seed S] [--max-secs X] [--out file.csv]
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "../src/Game.hpp"
+#include "../src/engine/Profiler.hpp"
+
+struct RunResult {
+    int sector = 0;
+    bool cleared = false, died = false;
+    float seconds = 0.0f, damage = 0.0f;
+    int score = 0;
+};
+
+// Plays through the same input path as a human: actions and mouse position go into the
+// InputHandler, then handleInput() and update() run as in a replay.
+class Bot {
+public:
+    explicit Bot(uint64_t seed) : rng(seed) {}
+
+    void drive(Game& g, double ts) {
+        Vec2 me = g.p->bounds.center();
+        RogueCore* target = nullptr;
+        float best = 1e9f;
+        for (auto c : g.cores) {
+            if (c->sanitized || !c->active) continue;
+            float d = c->bounds.center().distance(me);
+            if (d < best) { best = d; target = c; }
+        }
+        Vec2 goal = me;
+        bool fire = false, pulse = false;
+        if (target) {
+            goal = target->bounds.center();
+            bool seen = best < 320.0f && g.los.visible(me, goal, g.map);
+            if (!target->contained && seen) {
+                fire = g.p->slugs > 0;
+                pulse = best < 150.0f && g.p->energy > 60.0f;
+                if (best < 200.0f) goal = me; // Hold position and shoot
+            }
+            g.input.mPos = target->bounds.center() - g.cam;
+        } else if (g.exit && g.exit->active) {
+            goal = g.exit->bounds.center();
+        }
+        press(g, Action::FIRE, fire, ts);
+        press(g, Action::PULSE, pulse, ts);
+        press(g, Action::RELOAD, g.p->slugs == 0 && g.p->reserveSlugs > 0 && !g.input.isPressed(Action::RELOAD), ts);
+        steer(g, me, goal, ts);
+    }
+
+private:
+    Rng rng;
+    Vec2 lastPos;
+    int stuckTicks = 0, wanderTicks = 0, wanderDir = 0;
+    std::vector<int> parent, frontier;
+
+    static void press(Game& g, Action a, bool down, double ts) { if (g.input.isPressed(a) != down) g.input.push(a, down, ts); }
+
+    void steer(Game& g, Vec2 me, Vec2 goal, double ts) {
+        Vec2 dir = {0, 0};
+        if (wanderTicks > 0) {
+            wanderTicks--;
+            const Vec2 dirs[4] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+            dir = dirs[wanderDir];
+        } else if (goal.distance(me) > 8.0f) {
+            dir = nextStep(g, me, goal) - me;
+            // Walking into a corner without making progress: wander for a moment
+            if (me.distance(lastPos) < 0.5f && ++stuckTicks > 20) { stuckTicks = 0; wanderTicks = 15; wanderDir = rng.next() % 4; }
+        }
+        if (me.distance(lastPos) >= 0.5f) stuckTicks = 0;
+        lastPos = me;
+        press(g, Action::MOVE_RIGHT, dir.x > 3.0f, ts);
+        press(g, Action::MOVE_LEFT, dir.x < -3.0f, ts);
+        press(g, Action::MOVE_DOWN, dir.y > 3.0f, ts);
+        press(g, Action::MOVE_UP, dir.y < -3.0f, ts);
+    }
+
+    // Centre of the next tile on a BFS path to goal's tile
+    Vec2 nextStep(const Game& g, Vec2 me, Vec2 goal) {
+        int w = (int)g.map[0].size(), h = (int)g.map.size();
+        int start = (int)(me.y / TILE_SIZE) * w + (int)(me.x / TILE_SIZE), end = (int)(goal.y / TILE_SIZE) * w + (int)(goal.x / TILE_SIZE);
+        if (start == end) return goal;
+        parent.assign(w * h, -1); frontier.clear();
+        parent[start] = start; frontier.push_back(start);
+        for (size_t i = 0; i < frontier.size() && parent[end] < 0; ++i) {
+            int c = frontier[i], cx = c % w, cy = c / w;
+            const int dx[] = {1, -1, 0, 0}, dy[] = {0, 0, 1, -1};
+            for (int k = 0; k < 4; ++k) {
+                int nx = cx + dx[k], ny = cy + dy[k], n = ny * w + nx;
+                if (nx < 0 || ny < 0 || nx >= w || ny >= h || parent[n] >= 0 || g.map[ny][nx].type == WALL) continue;
+                parent[n] = c; frontier.push_back(n);
+            }
+        }
+        if (parent[end] < 0) return goal;
+        int step = end;
+        while (parent[step] != start) step = parent[step];
+        return {(step % w) * TILE_SIZE + TILE_SIZE / 2.0f, (step / w) * TILE_SIZE + TILE_SIZE / 2.0f};
+    }
+};
+
+static RunResult playSector(int sector, uint64_t seed, int maxTicks) {
+    gameRng().reseed(seed);
+    Game g(true, false, 0, false); // Built once below, for the sector under test
+    g.replaying = true; // No progress saves
+    g.sector = sector;
+    g.init();
+    Bot bot(seed ^ 0xB07B07ull);
+    RunResult r;
+    r.sector = sector;
+    float hp = g.p->suitIntegrity + std::max(0.0f, g.p->shield);
+    double ts = 0.0;
+    int tick = 0;
+    for (; tick < maxTicks && g.state == GameState::PLAYING; ++tick, ts += SIM_DT) {
+        bot.drive(g, ts);
+        g.input.beginTick(ts, ts + SIM_DT);
+        g.handleInput();
+        g.update();
+        g.input.endTick();
+        float now = g.p->suitIntegrity + std::max(0.0f, g.p->shield);
+        if (now < hp) r.damage += hp - now;
+        hp = now;
+    }
+    r.cleared = g.state == GameState::SUMMARY;
+    r.died = g.state == GameState::GAME_OVER;
+    r.seconds = tick * SIM_DT;
+    r.score = g.score;
+    return r;
+}
+
+int main(int argc, char** argv) {
+    int runs = 200, firstSector = 1, lastSector = 10, threads = -1;
+    uint64_t seed = 1;
+    float maxSecs = 300.0f;
+    const char* outPath = nullptr;
+    for (int i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "--runs") && i + 1 < argc) runs = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--sectors") && i + 1 < argc) { if (sscanf(argv[++i], "%d-%d", &firstSector, &lastSector) == 1) lastSector = firstSector; }
+        else if (!strcmp(argv[i], "--threads") && i + 1 < argc) threads = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--seed") && i + 1 < argc) seed = strtoull(argv[++i], nullptr, 10);
+        else if (!strcmp(argv[i], "--max-secs") && i + 1 < argc) maxSecs = (float)atof(argv[++i]);
+        else if (!strcmp(argv[i], "--out") && i + 1 < argc) outPath = argv[++i];
+        else { fprintf(stderr, "usage: %s [--runs N per sector] [--sectors A-B] [--threads T] [--seed S] [--max-secs X] [--out file.csv]\n", argv[0]); return 2; }
+    }
+    int sectors = std::max(1, lastSector - firstSector + 1), total = runs * sectors, maxTicks = (int)(maxSecs / SIM_DT);
+    Profiler::get().setEnabled(false);
+    JobSystem pool(threads < 0 ? -1 : std::max(0, threads - 1));
+    std::vector<RunResult> results(total);
+    auto st = std::chrono::steady_clock::now();
+    // Results land by index, so the CSV does not depend on the thread count or scheduling
+    auto body = [&](int b, int e) {
+        for (int i = b; i < e; ++i) {
+            uint64_t s = (seed + (uint64_t)i) * 0x9E3779B97F4A7C15ull;
+            results[i] = playSector(firstSector + i % sectors, s ? s : 1, maxTicks);
+        }
+    };
+    pool.parallelFor(total, 1, body);
+    double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - st).count();
+    double simSecs = 0.0;
+    for (const auto& r : results) simSecs += r.seconds;
+
+    FILE* out = outPath ? fopen(outPath, "w") : stdout;
+    if (!out) { fprintf(stderr, "balance: cannot write %s\n", outPath); return 1; }
+    fprintf(out, "sector,runs,survival_rate,clear_rate,clear_secs_mean,clear_secs_p90,score_mean,damage_mean\n");
+    for (int s = firstSector; s <= firstSector + sectors - 1; ++s) {
+        int n = 0, alive = 0;
+        double score = 0.0, damage = 0.0;
+        std::vector<float> clearTimes;
+        for (const auto& r : results) {
+            if (r.sector != s) continue;
+            n++; alive += !r.died; score += r.score; damage += r.damage;
+            if (r.cleared) clearTimes.push_back(r.seconds);
+        }
+        std::sort(clearTimes.begin(), clearTimes.end());
+        double clearMean = 0.0;
+        for (float t : clearTimes) clearMean += t;
+        if (!clearTimes.empty()) clearMean /= clearTimes.size();
+        float p90 = clearTimes.empty() ? 0.0f : clearTimes[std::min(clearTimes.size() - 1, (size_t)(0.9 * clearTimes.size()))];
+        fprintf(out, "%d,%d,%.3f,%.3f,%.1f,%.1f,%.0f,%.1f\n", s, n, n ? (double)alive / n : 0.0, n ? (double)clearTimes.size() / n : 0.0, clearMean, p90, n ? score / n : 0.0, n ? damage / n : 0.0);
+    }
+    if (outPath) fclose(out);
+    fprintf(stderr, "balance: %d runs on %d threads in %.2fs: %.1f runs/s, %.0fx realtime\n",
+            total, pool.threadCount(), secs, secs > 0 ? total / secs : 0.0, secs > 0 ? simSecs / secs : 0.0);
+    return 0;
+}
@@ -0,0 +1,272 @@
+// Micro-benchmarks for engine kernels. Build with `make bench`, run ./bench [filter].
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "../src/core/Constants.hpp"
+#include "../src/core/FastMath.hpp"
+#include "../src/engine/LineOfSight.hpp"
+#include "../src/engine/LightingManager.hpp"
+#include "../src/gameplay/AIScheduler.hpp"
+#include "../src/engine/JobSystem.hpp"
+#include "../src/engine/VFXManager.hpp"
+#include "../src/engine/Collision.hpp"
+#include "../src/gameplay/Slug.hpp"
+#include "../src/gameplay/Serialize.hpp"
+#include "../src/engine/Arena.hpp"
+#include "../src/engine/AudioManager.hpp"
+#include "../src/engine/World.hpp"
+#include "../src/engine/Proximity.hpp"
+
+using Map = std::vector<std::vector<Tile>>;
+
+template <typename F>
+static void bench(const char* name, int iters, F body) {
+    body(); // Warm-up
+    auto st = std::chrono::steady_clock::now();
+    for (int i = 0; i < iters; ++i) body();
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - st).count() / iters;
+    printf("%-40s %12.1f ns/iter\n", name, ns);
+}
+
+static Map makeMap(int w, int h, int wallPct, unsigned seed) {
+    srand(seed);
+    Map m(h, std::vector<Tile>(w));
+    for (int y = 0; y < h; ++y) for (int x = 0; x < w; ++x) {
+        bool edge = x == 0 || y == 0 || x == w - 1 || y == h - 1;
+        m[y][x].type = (edge || rand() % 100 < wallPct) ? WALL : FLOOR;
+        m[y][x].rect = {(float)x * TILE_SIZE, (float)y * TILE_SIZE, (float)TILE_SIZE, (float)TILE_SIZE};
+    }
+    return m;
+}
+
+static void benchLineOfSight() {
+    Map map = makeMap(MAP_WIDTH, MAP_HEIGHT, 20, 7);
+    std::vector<Vec2> pts;
+    for (int i = 0; i < 256; ++i) pts.push_back({(float)(40 + rand() % ((MAP_WIDTH - 2) * TILE_SIZE)), (float)(40 + rand() % ((MAP_HEIGHT - 2) * TILE_SIZE))});
+    LineOfSight los;
+    volatile int sink = 0;
+    bench("los.visible x256 (cold cache)", 2000, [&] {
+        los.beginFrame();
+        for (size_t i = 0; i < pts.size(); ++i) sink += los.visible(pts[i], pts[(i * 7 + 3) % pts.size()], map);
+    });
+    los.beginFrame();
+    bench("los.visible x256 (warm cache)", 2000, [&] {
+        for (size_t i = 0; i < pts.size(); ++i) sink += los.visible(pts[i], pts[(i * 7 + 3) % pts.size()], map);
+    });
+    bench("los.raycast x256 (500px)", 2000, [&] {
+        for (size_t i = 0; i < pts.size(); ++i) { float a = i * 0.0245f; sink += los.raycast(pts[i], {std::cos(a), std::sin(a)}, 500.0f, map).hit; }
+    });
+    LightingManager lighting;
+    bench("lighting.update (180 rays)", 2000, [&] { lighting.update(pts[0], map); });
+}
+
+static void benchAIScheduler() {
+    Map map = makeMap(MAP_WIDTH, MAP_HEIGHT, 12, 11);
+    std::vector<RogueCore*> cores;
+    for (int i = 0; i < 64; ++i) {
+        int x, y; do { x = 1 + rand() % (MAP_WIDTH - 2); y = 1 + rand() % (MAP_HEIGHT - 2); } while (map[y][x].type == WALL);
+        cores.push_back(new RogueCore({(float)x * TILE_SIZE + 6, (float)y * TILE_SIZE + 6}));
+    }
+    Vec2 target = {MAP_WIDTH * TILE_SIZE / 2.0f + 20, MAP_HEIGHT * TILE_SIZE / 2.0f + 20};
+    map[(int)target.y / TILE_SIZE][(int)target.x / TILE_SIZE].type = FLOOR;
+    // Worst case: every core wants a new path on the same frame
+    auto st = std::chrono::steady_clock::now();
+    for (auto c : cores) c->calculatePath(target, map);
+    double burstUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - st).count();
+    printf("%-40s %12.1f us/frame\n", "ai.unscheduled burst (64 cores)", burstUs);
+    AIScheduler sched;
+    for (auto c : cores) sched.requestReplan(c, 100.0f);
+    int frames = 0; float worst = 0.0f;
+    while (sched.pending()) { sched.processReplans(target, map); worst = std::max(worst, sched.spentUs); frames++; }
+    // If measured frames overshoot the budget on this machine, recalibrate AI_PATH_*_US
+    printf("%-40s %12.1f us/frame over %d frames (budget %.0f)\n", "ai.scheduled worst frame (64 cores)", worst, frames, sched.budgetUs);
+    for (auto c : cores) delete c;
+}
+
+static void benchJobSystem() {
+    VFXManager vfx;
+    for (int i = 0; i < 200000; ++i) vfx.particles.push_back({{0, 0}, {1, 1}, 1e9f, 1e9f, {255, 255, 255, 255}, 2.0f});
+    int hw = std::max(1, (int)std::thread::hardware_concurrency());
+    for (int workers = 0; workers < hw; workers = workers ? workers * 2 : 1) {
+        JobSystem jobs(workers);
+        auto body = [&](int b, int e) { for (int r = 0; r < 8; ++r) vfx.integrate(0.001f, b, e); };
+        char name[64]; snprintf(name, sizeof(name), "jobs.integrate 200k particles (%d thr)", jobs.threadCount());
+        bench(name, 50, [&] { jobs.parallelFor((int)vfx.particles.size(), 2048, body); });
+    }
+}
+
+static void benchSweep() {
+    Map map = makeMap(MAP_WIDTH, MAP_HEIGHT, 20, 5);
+    for (float speed : {200.0f, 850.0f, 3000.0f}) {
+        std::vector<KineticSlug> ss;
+        for (int i = 0; i < 256; ++i) {
+            int x, y; do { x = 1 + rand() % (MAP_WIDTH - 2); y = 1 + rand() % (MAP_HEIGHT - 2); } while (map[y][x].type == WALL);
+            float a = i * 0.0245f;
+            ss.emplace_back(Vec2{(float)x * TILE_SIZE + 17, (float)y * TILE_SIZE + 17}, Vec2{std::cos(a) * speed, std::sin(a) * speed}, true);
+            ss.back().bounces = 1 << 30;
+        }
+        char name[64]; snprintf(name, sizeof(name), "sweep.slug x256 @ %.0f px/s", speed);
+        bench(name, 2000, [&] { for (auto& s : ss) { s.update(1.0f / 60.0f, map); s.tail.clear(); } });
+    }
+}
+
+static void benchSnapshot() {
+    for (int size : {50, 200, 800}) {
+        Map map = makeMap(size, size, 20, 3);
+        std::vector<RogueCore*> cores;
+        std::vector<KineticSlug*> slugs;
+        for (int i = 0; i < 40; ++i) {
+            cores.push_back(new RogueCore({(float)(rand() % 1800), (float)(rand() % 1800)}));
+            for (int k = 0; k < 20; ++k) cores.back()->path.push_back({(float)k * 40, (float)k * 40});
+        }
+        for (int i = 0; i < 30; ++i) { slugs.push_back(new KineticSlug({100, 100}, {800, 0}, true)); for (int k = 0; k < 12; ++k) slugs.back()->tail.push(Vec2(1, 1)); }
+        Snapshot::Writer w;
+        auto save = [&] {
+            w.buf.clear();
+            Serialize::writeMap(w, map);
+            w.put((uint32_t)cores.size()); for (auto c : cores) Serialize::writeCore(w, c, cores);
+            w.put((uint32_t)slugs.size()); for (auto sl : slugs) Serialize::writeSlug(w, *sl);
+        };
+        Map loaded;
+        Arena arena;
+        auto restore = [&] {
+            arena.reset();
+            Snapshot::Reader r(w.buf.data(), w.buf.size());
+            Serialize::readMap(r, loaded, size, size);
+            uint32_t n = r.get<uint32_t>(); int t;
+            for (uint32_t i = 0; i < n; ++i) Serialize::readCore(r, arena, t);
+            n = r.get<uint32_t>();
+            for (uint32_t i = 0; i < n; ++i) Serialize::readSlug(r, arena);
+        };
+        char name[64];
+        snprintf(name, sizeof(name), "snapshot.save %dx%d", size, size);
+        bench(name, 200, save);
+        snprintf(name, sizeof(name), "snapshot.restore %dx%d (%zu KB)", size, size, w.buf.size() / 1024);
+        bench(name, 200, restore);
+        for (auto c : cores) delete c;
+        for (auto sl : slugs) delete sl;
+    }
+}
+
+// Slug churn as in a firefight: spawn a burst, retire most of them, repeat; then drop the sector
+static void benchArena() {
+    std::vector<KineticSlug*> live;
+    bench("alloc.slug churn (new/delete)", 2000, [&] {
+        for (int i = 0; i < 64; ++i) live.push_back(new KineticSlug({100, 100}, {800, 0}, true));
+        for (size_t i = 0; i < live.size(); i += 2) { delete live[i]; live[i] = nullptr; }
+        live.erase(std::remove(live.begin(), live.end(), nullptr), live.end());
+        if (live.size() > 4096) { for (auto s : live) delete s; live.clear(); }
+    });
+    for (auto s : live) delete s;
+    live.clear();
+    Arena arena;
+    bench("alloc.slug churn (arena)", 2000, [&] {
+        for (int i = 0; i < 64; ++i) live.push_back(arena.make<KineticSlug>(Vec2{100, 100}, Vec2{800, 0}, true));
+        for (size_t i = 0; i < live.size(); i += 2) { arena.destroy(live[i]); live[i] = nullptr; }
+        live.erase(std::remove(live.begin(), live.end(), nullptr), live.end());
+        if (live.size() > 4096) { arena.reset(); live.clear(); }
+    });
+}
+
+// A firefight's worth of overlapping one-shots, mixed through the audio callback (one 1024-frame buffer)
+static void benchAudio() {
+    static float buf[2048];
+    for (bool banked : {false, true}) {
+        AudioManager audio;
+        if (banked) audio.buildSampleBank();
+        int n = 0;
+        char name[64]; snprintf(name, sizeof(name), "audio.mix 24 one-shots (%s)", banked ? "sample bank" : "synthesized");
+        bench(name, 2000, [&] {
+            for (int i = 0; i < 24; ++i, ++n) {
+                SoundType t = (n % 3 == 0) ? SoundType::STEP : (n % 3 == 1 ? SoundType::RICOCHET : SoundType::ZAP);
+                audio.play(t, 0.2f, 800.0f + (n * 37) % 1200);
+            }
+            AudioManager::audioCallback(&audio, (Uint8*)buf, sizeof(buf));
+        });
+    }
+    // Every synth type at once, kept at 32 live voices: runtime dispatch per sample vs one kernel per type
+    for (bool kernels : {false, true}) {
+        AudioManager audio;
+        audio.useVoiceKernels = kernels;
+        int n = 0;
+        char name[64]; snprintf(name, sizeof(name), "audio.mix 32 mixed voices (%s)", kernels ? "voice kernels" : "dynamic dispatch");
+        bench(name, 2000, [&] {
+            for (int i = 0; i < 32; ++i, ++n) audio.play((SoundType)(n % (int)SoundType::COUNT), 0.1f, 300.0f + (n * 37) % 900);
+            AudioManager::audioCallback(&audio, (Uint8*)buf, sizeof(buf));
+        });
+    }
+}
+
+// Endurance streaming: a window slide regenerates one row of chunks and refills the map from the cache
+static void benchWorld() {
+    ChunkedWorld world;
+    world.reset(42);
+    Map map;
+    int cx = 0;
+    bench("world.slide window (1 new chunk column)", 2000, [&] { world.fillWindow(++cx, 0, map); });
+    bench("world.refill window (all cached)", 2000, [&] { world.fillWindow(cx, 0, map); });
+    printf("%-40s %12d chunks (%llu generated, %llu evicted)\n", "world.cache resident", world.loadedChunks(), (unsigned long long)world.generated, (unsigned long long)world.evicted);
+}
+
+// Distance from the player to 256 cores, as updateAI needs it: one sqrt per entity vs the SoA squared pass
+static void benchProximity() {
+    std::vector<Vec2> pos(256);
+    for (auto& v : pos) v = {(float)(rand() % 3000), (float)(rand() % 2000)};
+    Vec2 me = {1500, 1000};
+    std::vector<float> dist(pos.size());
+    volatile float sink = 0;
+    bench("proximity.256 (distance per entity)", 20000, [&] {
+        for (size_t i = 0; i < pos.size(); ++i) dist[i] = pos[i].distance(me);
+        sink = dist[17];
+    });
+    ProximitySet set;
+    bench("proximity.256 (SoA build + measure)", 20000, [&] {
+        set.build((int)pos.size(), [&](int i) { return pos[i]; });
+        set.measure(me);
+        sink = set.d2[17];
+    });
+    bench("proximity.256 (SoA measure only)", 20000, [&] { set.measure(me); sink = set.d2[17]; });
+}
+
+// FastMath against libm: worst error over a dense sweep of each domain, then throughput over 4096 inputs
+static void benchMath() {
+    double sinErr = 0, atanErr = 0;
+    for (int i = 0; i <= 2000000; ++i) {
+        float u = i / 2000000.0f;
+        float x = -30000.0f + 60000.0f * u; // Voice phases reach ~2e4 rad
+        sinErr = std::max(sinErr, (double)std::fabs(FastMath::sin(x) - std::sin(x)));
+        sinErr = std::max(sinErr, (double)std::fabs(FastMath::cos(x) - std::cos(x)));
+        float a = u * 6.2831853f;
+        float ay = std::sin(a) * (0.001f + 50.0f * u), ax = std::cos(a) * (0.001f + 50.0f * u);
+        atanErr = std::max(atanErr, (double)std::fabs(FastMath::atan2(ay, ax) - std::atan2(ay, ax)));
+    }
+    printf("%-40s sin/cos %.1e abs, atan2 %.1e rad\n", "math.max error", sinErr, atanErr);
+
+    std::vector<float> in(4096), in2(4096);
+    for (size_t i = 0; i < in.size(); ++i) { in[i] = (rand() / (float)RAND_MAX - 0.5f) * 200.0f; in2[i] = rand() / (float)RAND_MAX * 100.0f + 0.01f; }
+    volatile float sink = 0;
+    auto run = [&](const char* name, auto f) {
+        bench(name, 2000, [&] { float acc = 0; for (size_t i = 0; i < in.size(); ++i) acc += f(in[i], in2[i]); sink = acc; });
+    };
+    run("math.sin x4096 (std)", [](float x, float) { return std::sin(x); });
+    run("math.sin x4096 (fast)", [](float x, float) { return FastMath::sin(x); });
+    run("math.atan2 x4096 (std)", [](float x, float y) { return std::atan2(x, y); });
+    run("math.atan2 x4096 (fast)", [](float x, float y) { return FastMath::atan2(x, y); });
+}
+
+int main(int argc, char** argv) {
+    const char* filter = (argc > 1) ? argv[1] : "";
+    if (strstr("los", filter)) benchLineOfSight();
+    if (strstr("ai", filter)) benchAIScheduler();
+    if (strstr("jobs", filter)) benchJobSystem();
+    if (strstr("sweep", filter)) benchSweep();
+    if (strstr("snapshot", filter)) benchSnapshot();
+    if (strstr("alloc", filter)) benchArena();
+    if (strstr("audio", filter)) benchAudio();
+    if (strstr("world", filter)) benchWorld();
+    if (strstr("math", filter)) benchMath();
+    if (strstr("proximity", filter)) benchProximity();
+    return 0;
+}
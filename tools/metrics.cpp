@@ -0,0 +1,113 @@
+// Offline analysis of a --metrics stream: the frame-time distribution, which phases and counters move
+// with frame time, and the worst spikes with what was unusual about each. Build with `make metrics`,
+// run ./metrics file.bin [--top N] [--spike-ms X]
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "../src/engine/Metrics.hpp"
+
+// Every column as a double: phases first (in ms), then counters
+static const int COLUMNS = FrameMetrics::PHASES + FrameMetrics::COUNTERS;
+
+static const char* columnName(int c) { return c < FrameMetrics::PHASES ? FrameMetrics::PHASE_NAMES[c] : FrameMetrics::COUNTER_NAMES[c - FrameMetrics::PHASES]; }
+static bool isPhase(int c) { return c < FrameMetrics::PHASES; }
+static double column(const FrameMetrics& m, int c) { return isPhase(c) ? m.us[c] / 1000.0 : m.count[c - FrameMetrics::PHASES]; }
+
+static double median(std::vector<double> v) {
+    if (v.empty()) return 0.0;
+    std::nth_element(v.begin(), v.begin() + v.size() / 2, v.end());
+    return v[v.size() / 2];
+}
+
+static double pearson(const std::vector<double>& a, const std::vector<double>& b) {
+    double n = a.size(), ma = 0, mb = 0;
+    for (size_t i = 0; i < a.size(); ++i) { ma += a[i]; mb += b[i]; }
+    ma /= n; mb /= n;
+    double sab = 0, saa = 0, sbb = 0;
+    for (size_t i = 0; i < a.size(); ++i) { sab += (a[i] - ma) * (b[i] - mb); saa += (a[i] - ma) * (a[i] - ma); sbb += (b[i] - mb) * (b[i] - mb); }
+    return (saa > 0 && sbb > 0) ? sab / std::sqrt(saa * sbb) : 0.0;
+}
+
+int main(int argc, char** argv) {
+    const char* path = nullptr;
+    int top = 10;
+    double spikeMs = -1.0;
+    for (int i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "--top") && i + 1 < argc) top = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--spike-ms") && i + 1 < argc) spikeMs = atof(argv[++i]);
+        else if (!path && argv[i][0] != '-') path = argv[i];
+        else { path = nullptr; break; }
+    }
+    if (!path) { fprintf(stderr, "usage: %s file.bin [--top N] [--spike-ms X]\n", argv[0]); return 2; }
+    std::vector<FrameMetrics> frames;
+    if (!MetricsLog::read(path, frames)) { fprintf(stderr, "metrics: %s is missing or not a version %u stream\n", path, MetricsLog::VERSION); return 1; }
+    if (frames.empty()) { printf("metrics: no frames\n"); return 0; }
+
+    std::vector<std::vector<double>> cols(COLUMNS, std::vector<double>(frames.size()));
+    for (size_t f = 0; f < frames.size(); ++f) for (int c = 0; c < COLUMNS; ++c) cols[c][f] = column(frames[f], c);
+    // Robust baseline per column: median and scaled median absolute deviation
+    double med[COLUMNS], spread[COLUMNS];
+    for (int c = 0; c < COLUMNS; ++c) {
+        med[c] = median(cols[c]);
+        std::vector<double> dev(cols[c].size());
+        for (size_t f = 0; f < dev.size(); ++f) dev[f] = std::fabs(cols[c][f] - med[c]);
+        spread[c] = std::max(1.4826 * median(dev), isPhase(c) ? 0.05 : 1.0); // Floors: 50 us, one unit
+    }
+
+    const std::vector<double>& ft = cols[FrameMetrics::FRAME];
+    std::vector<double> sorted = ft;
+    std::sort(sorted.begin(), sorted.end());
+    auto pct = [&](double q) { return sorted[std::min(sorted.size() - 1, (size_t)(q * sorted.size()))]; };
+    if (spikeMs < 0) spikeMs = 2.0 * med[FrameMetrics::FRAME];
+    int spikes = 0;
+    for (double v : ft) spikes += v > spikeMs;
+    printf("%zu frames: p50 %.2f ms, p95 %.2f, p99 %.2f, max %.2f; %d over %.2f ms\n", frames.size(), pct(0.5), pct(0.95), pct(0.99), sorted.back(), spikes, spikeMs);
+    // The game numbers every frame, so a jump means a batch was shed while the disk stalled
+    int gaps = 0;
+    uint64_t missing = 0;
+    for (size_t f = 1; f < frames.size(); ++f) {
+        if (frames[f].frame <= frames[f - 1].frame + 1) continue;
+        if (gaps++ < top) printf("  gap after frame %u: %u frames missing\n", frames[f - 1].frame, frames[f].frame - frames[f - 1].frame - 1);
+        missing += frames[f].frame - frames[f - 1].frame - 1;
+    }
+    if (gaps) printf("%d gaps, %llu frames missing: the writer fell behind, stalls around them are undercounted\n", gaps, (unsigned long long)missing);
+
+    printf("\ncorrelation with frame time:\n");
+    std::vector<std::pair<double, int>> corr;
+    for (int c = 1; c < COLUMNS; ++c) corr.push_back({pearson(ft, cols[c]), c});
+    std::sort(corr.begin(), corr.end(), [](const std::pair<double, int>& a, const std::pair<double, int>& b) { return std::fabs(a.first) > std::fabs(b.first); });
+    for (auto& cr : corr) if (cr.first != 0.0) printf("  %-14s %+.2f   (median %.2f%s)\n", columnName(cr.second), cr.first, med[cr.second], isPhase(cr.second) ? " ms" : "");
+
+    // For each spike, the columns furthest above their own baseline are its likely causes
+    std::vector<int> order;
+    for (size_t f = 0; f < frames.size(); ++f) if (ft[f] > spikeMs) order.push_back((int)f);
+    std::sort(order.begin(), order.end(), [&](int a, int b) { return ft[a] > ft[b]; });
+    int leading[COLUMNS] = {};
+    for (size_t k = 0; k < order.size(); ++k) {
+        int f = order[k];
+        std::vector<std::pair<double, int>> score;
+        for (int c = 1; c < COLUMNS; ++c) {
+            double z = (cols[c][f] - med[c]) / spread[c];
+            if (z > 3.0) score.push_back({z, c});
+        }
+        std::sort(score.rbegin(), score.rend());
+        if (!score.empty()) leading[score[0].second]++;
+        if ((int)k >= top) continue;
+        if (k == 0) printf("\nworst spikes:\n");
+        printf("  frame %-7u %7.2f ms:", frames[f].frame, ft[f]);
+        if (score.empty()) printf(" nothing unusual recorded");
+        for (size_t i = 0; i < score.size() && i < 4; ++i) {
+            int c = score[i].second;
+            printf(isPhase(c) ? "  %s %.2f ms (med %.2f)" : "  %s %.0f (med %.0f)", columnName(c), cols[c][f], med[c]);
+        }
+        printf("\n");
+    }
+    if (!order.empty()) {
+        printf("\nspikes by leading cause:\n");
+        for (int c = 1; c < COLUMNS; ++c) if (leading[c]) printf("  %-14s %d\n", columnName(c), leading[c]);
+    }
+    return 0;
+}